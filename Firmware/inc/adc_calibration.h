@@ -0,0 +1,58 @@
+#ifndef ADC_CALIBRATION_H
+#define ADC_CALIBRATION_H
+
+#include <cstdint>
+
+// Linear calibration of 12-bit conversions, applied as (sample + offset) * gain
+// with the gain in Q14 fixed point, i.e. 16384 is unity and the largest gain
+// is just under four. Offsets are limited to the conversion range so the
+// product always fits in 32 bits for inputs between -0x1000 and 0x1FFF,
+// which covers the signed outputs of the conversion filters.
+const uint32_t CALIBRATION_GAIN_BITS = 14;
+const uint16_t CALIBRATION_UNITY_GAIN = 1u << CALIBRATION_GAIN_BITS;
+const int16_t CALIBRATION_MAX_OFFSET = 0xFFF;
+const uint16_t CALIBRATION_SAMPLE_MAX = 0xFFF;
+
+struct adc_calibration_t
+{
+    int16_t offset;
+    uint16_t gain;
+};
+
+inline void calibration_reset(adc_calibration_t& calibration)
+{
+    calibration.offset = 0;
+    calibration.gain = CALIBRATION_UNITY_GAIN;
+}
+
+inline bool calibration_valid(const adc_calibration_t& calibration)
+{
+    return calibration.offset >= -CALIBRATION_MAX_OFFSET &&
+           calibration.offset <= CALIBRATION_MAX_OFFSET;
+}
+
+// Returns the calibrated sample, rounded and clamped to the conversion range.
+inline uint16_t calibration_apply(const adc_calibration_t& calibration, int32_t sample)
+{
+    int32_t value = (sample + calibration.offset) * calibration.gain;
+    if (value <= 0)
+        return 0;
+
+    value = (value + (1 << (CALIBRATION_GAIN_BITS - 1))) >> CALIBRATION_GAIN_BITS;
+    return value > CALIBRATION_SAMPLE_MAX ? CALIBRATION_SAMPLE_MAX : (uint16_t)value;
+}
+
+// FNV-1a hash used to validate calibration records persisted in flash.
+inline uint32_t calibration_checksum(const adc_calibration_t* calibration, uint32_t count)
+{
+    const uint8_t* data = (const uint8_t*)calibration;
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < count * sizeof(adc_calibration_t); i++)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+#endif // ADC_CALIBRATION_H
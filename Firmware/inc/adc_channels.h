@@ -0,0 +1,39 @@
+#ifndef ADC_CHANNELS_H
+#define ADC_CHANNELS_H
+
+#include <cstdint>
+
+// The RP2040 ADC multiplexes five inputs: GPIO26-29 on inputs 0-3 and the
+// internal temperature sensor on input 4. Channel enable masks use one bit
+// per ADC input, so a mask doubles as the round-robin register value.
+// In round-robin mode the ADC converts enabled inputs in ascending order,
+// which defines the position of each channel inside a frame.
+const uint32_t ADC_INPUT_COUNT = 5;
+const uint32_t ADC_TEMPERATURE_INPUT = 4;
+const uint32_t ADC_CHANNEL_MASK = 0x17; // Inputs 0-2 and the temperature sensor.
+
+struct adc_frame_layout_t
+{
+    uint32_t round_robin_mask;       // Raw value for the ADC round-robin register.
+    uint32_t channel_count;          // Number of conversions in each scan.
+    uint8_t inputs[ADC_INPUT_COUNT]; // ADC input converted at each scan position.
+};
+
+// Computes the order of conversions in each scan of the enabled channels.
+// Returns false if no channel is enabled or the mask selects unsupported inputs.
+inline bool adc_compute_frame_layout(uint32_t channel_mask, adc_frame_layout_t& layout)
+{
+    if (channel_mask == 0 || (channel_mask & ~ADC_CHANNEL_MASK) != 0)
+        return false;
+
+    layout.round_robin_mask = channel_mask;
+    layout.channel_count = 0;
+    for (uint32_t input = 0; input < ADC_INPUT_COUNT; input++)
+    {
+        if (channel_mask & (1u << input))
+            layout.inputs[layout.channel_count++] = (uint8_t)input;
+    }
+    return true;
+}
+
+#endif // ADC_CHANNELS_H
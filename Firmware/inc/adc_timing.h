@@ -0,0 +1,68 @@
+#ifndef ADC_TIMING_H
+#define ADC_TIMING_H
+
+#include <cstdint>
+
+// The RP2040 ADC runs from a 48MHz clock and needs 96 cycles per conversion,
+// which caps the aggregate rate across all round-robin inputs at 500ksps.
+// The DIV register holds the number of cycles between conversions minus one
+// as a 16.8 fixed-point value, so the slowest hardware-paced conversion rate
+// is just over 732Hz. Slower frame rates are reached by oversampling, i.e.
+// filtering several consecutive scans into each reported frame.
+const uint32_t ADC_CLOCK_HZ = 48000000;
+const uint32_t ADC_CONVERSION_CYCLES = 96;
+const uint32_t ADC_MAX_CONVERSION_RATE = ADC_CLOCK_HZ / ADC_CONVERSION_CYCLES;
+const uint32_t ADC_DIV_FRAC_BITS = 8;
+const uint64_t ADC_MIN_PERIOD = (uint64_t)ADC_CONVERSION_CYCLES << ADC_DIV_FRAC_BITS;
+const uint64_t ADC_MAX_PERIOD = ((uint64_t)0x10000 << ADC_DIV_FRAC_BITS) | 0xFF;
+
+struct adc_timing_t
+{
+    uint32_t clkdiv;       // Raw value for the ADC DIV register.
+    uint32_t period;       // ADC clock cycles between conversions, in 1/256 cycles.
+    uint32_t oversampling; // Number of scans decimated into each frame.
+};
+
+// Computes the ADC clock divider and oversampling factor which produce frames
+// at the specified rate, with at least the specified number of scans per frame.
+// Returns false if the rate cannot be achieved.
+inline bool adc_compute_timing(uint32_t frame_rate_hz, uint32_t channel_count,
+                               uint32_t decimation, adc_timing_t& timing)
+{
+    if (frame_rate_hz == 0 || channel_count == 0 || decimation == 0)
+        return false;
+
+    // Use the smallest multiple of the decimation which fits in the clock divider.
+    const uint64_t frame_cycles = ((uint64_t)ADC_CLOCK_HZ << ADC_DIV_FRAC_BITS) / frame_rate_hz;
+    const uint64_t scan_limit = (uint64_t)channel_count * decimation * ADC_MAX_PERIOD;
+    const uint64_t oversampling = decimation * ((frame_cycles + scan_limit - 1) / scan_limit);
+    const uint64_t conversions = channel_count * oversampling;
+    const uint64_t period = (frame_cycles + conversions / 2) / conversions;
+    if (period < ADC_MIN_PERIOD)
+        return false;
+
+    timing.period = (uint32_t)period;
+    timing.clkdiv = (uint32_t)(period - (1u << ADC_DIV_FRAC_BITS));
+    timing.oversampling = (uint32_t)oversampling;
+    return true;
+}
+
+// Returns the ADC conversion rate, in conversions per second.
+inline uint32_t adc_conversion_rate(const adc_timing_t& timing)
+{
+    return (uint32_t)(((uint64_t)ADC_CLOCK_HZ << ADC_DIV_FRAC_BITS) / timing.period);
+}
+
+// Converts a number of ADC conversions into elapsed time in microseconds.
+inline uint64_t adc_conversions_to_us(uint64_t conversions, const adc_timing_t& timing)
+{
+    return (conversions * timing.period) / ((ADC_CLOCK_HZ / 1000000) << ADC_DIV_FRAC_BITS);
+}
+
+// Converts elapsed time in microseconds into the number of completed ADC conversions.
+inline uint64_t adc_us_to_conversions(uint64_t time_us, const adc_timing_t& timing)
+{
+    return (time_us * ((ADC_CLOCK_HZ / 1000000) << ADC_DIV_FRAC_BITS)) / timing.period;
+}
+
+#endif // ADC_TIMING_H
@@ -0,0 +1,70 @@
+#ifndef BIQUAD_FILTER_H
+#define BIQUAD_FILTER_H
+
+#include <cstdint>
+
+// Cascade of direct form I biquad sections with Q30 fixed-point coefficients,
+// implementing H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2) per
+// section. Samples are kept in Q16 between sections to preserve precision,
+// and products are accumulated in 64 bits. The output is signed, so high-pass
+// and band-pass designs can swing below zero, and is clamped to twice the
+// conversion range.
+const uint32_t BIQUAD_COEFFICIENT_BITS = 30;
+const uint32_t BIQUAD_SAMPLE_BITS = 16;
+const uint32_t BIQUAD_MAX_SECTIONS = 2;
+const uint32_t BIQUAD_COEFFICIENT_COUNT = 5;
+const int32_t BIQUAD_OUTPUT_MIN = -0x1000;
+const int32_t BIQUAD_OUTPUT_MAX = 0x1FFF;
+
+struct biquad_coefficients_t
+{
+    int32_t b0, b1, b2, a1, a2;
+};
+
+struct biquad_state_t
+{
+    int32_t x1, x2, y1, y2;
+};
+
+struct biquad_cascade_t
+{
+    uint32_t section_count;
+    biquad_coefficients_t coefficients[BIQUAD_MAX_SECTIONS];
+    biquad_state_t state[BIQUAD_MAX_SECTIONS];
+};
+
+inline void biquad_reset(biquad_cascade_t& cascade)
+{
+    for (uint32_t i = 0; i < BIQUAD_MAX_SECTIONS; i++)
+        cascade.state[i] = biquad_state_t{};
+}
+
+inline int32_t biquad_saturate(int64_t value)
+{
+    return value > INT32_MAX ? INT32_MAX : value < INT32_MIN ? INT32_MIN : (int32_t)value;
+}
+
+// Runs a sample through every section of the cascade and returns the output
+// rounded to the nearest conversion unit.
+inline int32_t biquad_process(biquad_cascade_t& cascade, int32_t sample)
+{
+    int32_t x = sample * (1 << BIQUAD_SAMPLE_BITS);
+    for (uint32_t i = 0; i < cascade.section_count; i++)
+    {
+        const biquad_coefficients_t& c = cascade.coefficients[i];
+        biquad_state_t& s = cascade.state[i];
+        int64_t acc = (int64_t)c.b0 * x + (int64_t)c.b1 * s.x1 + (int64_t)c.b2 * s.x2
+                    - (int64_t)c.a1 * s.y1 - (int64_t)c.a2 * s.y2;
+        int32_t y = biquad_saturate((acc + (1ll << (BIQUAD_COEFFICIENT_BITS - 1))) >> BIQUAD_COEFFICIENT_BITS);
+        s.x2 = s.x1;
+        s.x1 = x;
+        s.y2 = s.y1;
+        s.y1 = y;
+        x = y;
+    }
+
+    int32_t output = (x + (1 << (BIQUAD_SAMPLE_BITS - 1))) >> BIQUAD_SAMPLE_BITS;
+    return output < BIQUAD_OUTPUT_MIN ? BIQUAD_OUTPUT_MIN : output > BIQUAD_OUTPUT_MAX ? BIQUAD_OUTPUT_MAX : output;
+}
+
+#endif // BIQUAD_FILTER_H
@@ -0,0 +1,79 @@
+#ifndef CIC_FILTER_H
+#define CIC_FILTER_H
+
+#include <cstdint>
+
+// Cascaded integrator-comb decimation filter with unit differential delay.
+// Integrators run on every input sample and combs run once per decimated
+// output, so the cost per conversion is a handful of additions. A first
+// order filter is a boxcar average over the decimation window.
+// State uses modular 64-bit arithmetic, which is exact as long as the
+// filter gain times the input range fits in 63 bits.
+const uint32_t CIC_MAX_ORDER = 3;
+const uint32_t CIC_INPUT_MAX = 0xFFF;
+
+struct cic_filter_t
+{
+    uint64_t integrators[CIC_MAX_ORDER];
+    uint64_t combs[CIC_MAX_ORDER];
+};
+
+// Computes the DC gain of a filter with the specified decimation and order.
+// Returns false if the filter state could overflow.
+inline bool cic_compute_gain(uint32_t decimation, uint32_t order, uint64_t& gain)
+{
+    if (decimation == 0 || order == 0 || order > CIC_MAX_ORDER)
+        return false;
+
+    gain = 1;
+    const uint64_t limit = ((uint64_t)1 << 63) / CIC_INPUT_MAX;
+    for (uint32_t i = 0; i < order; i++)
+    {
+        if (gain > limit / decimation)
+            return false;
+        gain *= decimation;
+    }
+    return true;
+}
+
+inline void cic_reset(cic_filter_t& filter)
+{
+    for (uint32_t i = 0; i < CIC_MAX_ORDER; i++)
+    {
+        filter.integrators[i] = 0;
+        filter.combs[i] = 0;
+    }
+}
+
+inline void cic_integrate(cic_filter_t& filter, uint32_t order, uint32_t sample)
+{
+    uint64_t value = sample;
+    for (uint32_t i = 0; i < order; i++)
+    {
+        filter.integrators[i] += value;
+        value = filter.integrators[i];
+    }
+}
+
+// Runs the comb section and returns the decimated output normalized by the
+// filter gain, rounded to the nearest input unit.
+inline uint32_t cic_decimate(cic_filter_t& filter, uint32_t order, uint64_t gain)
+{
+    uint64_t value = filter.integrators[order - 1];
+    for (uint32_t i = 0; i < order; i++)
+    {
+        uint64_t delayed = filter.combs[i];
+        filter.combs[i] = value;
+        value -= delayed;
+    }
+
+    // Prefer the 32-bit hardware divider whenever the operands fit
+    if (gain == 1)
+        return (uint32_t)value;
+    value += gain / 2;
+    if ((value >> 32) == 0 && (gain >> 32) == 0)
+        return (uint32_t)value / (uint32_t)gain;
+    return (uint32_t)(value / gain);
+}
+
+#endif // CIC_FILTER_H
@@ -0,0 +1,67 @@
+#ifndef DELTA_CODEC_H
+#define DELTA_CODEC_H
+
+#include <cstdint>
+
+// Delta compression of interleaved 12-bit frames. A batch starts with the
+// number of channels per frame and a keyframe holding the first frame as
+// little-endian 16-bit values. Every subsequent value is stored as the
+// difference from the previous frame of the same channel, zig-zag mapped
+// to an unsigned integer and written as a little-endian base-128 varint.
+// Deltas of 12-bit values never need more than two bytes, so a frame is at
+// most as large as its uncompressed form.
+const uint32_t DELTA_MAX_CHANNELS = 8;
+
+struct delta_encoder_t
+{
+    uint32_t channel_count;
+    uint32_t length; // Bytes written to the batch buffer.
+    uint32_t frames; // Frames written to the batch buffer.
+    uint16_t previous[DELTA_MAX_CHANNELS];
+};
+
+inline uint32_t zigzag_encode(int32_t value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+// Returns the largest number of bytes a single frame can take.
+inline uint32_t delta_max_frame_size(uint32_t channel_count)
+{
+    return 2 * channel_count;
+}
+
+inline void delta_begin(delta_encoder_t& encoder, uint32_t channel_count, uint8_t* buffer)
+{
+    encoder.channel_count = channel_count;
+    encoder.frames = 0;
+    encoder.length = 0;
+    buffer[encoder.length++] = (uint8_t)channel_count;
+}
+
+inline void delta_add_frame(delta_encoder_t& encoder, const uint16_t* frame, uint8_t* buffer)
+{
+    for (uint32_t channel = 0; channel < encoder.channel_count; channel++)
+    {
+        uint16_t value = frame[channel];
+        if (encoder.frames == 0)
+        {
+            buffer[encoder.length++] = (uint8_t)value;
+            buffer[encoder.length++] = (uint8_t)(value >> 8);
+        }
+        else
+        {
+            uint32_t delta = zigzag_encode((int32_t)value - encoder.previous[channel]);
+            while (delta >= 0x80)
+            {
+                buffer[encoder.length++] = (uint8_t)(delta | 0x80);
+                delta >>= 7;
+            }
+            buffer[encoder.length++] = (uint8_t)delta;
+        }
+        encoder.previous[channel] = value;
+    }
+    encoder.frames++;
+}
+
+#endif // DELTA_CODEC_H
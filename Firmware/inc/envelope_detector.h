@@ -0,0 +1,91 @@
+#ifndef ENVELOPE_DETECTOR_H
+#define ENVELOPE_DETECTOR_H
+
+#include <cstdint>
+
+// Amplitude envelope of AC signals such as EMG or audio, computed on every
+// conversion. The signal baseline is tracked with a slow one-pole low-pass
+// filter in Q16 and subtracted before rectifying or squaring, so inputs can
+// be biased anywhere within the conversion range. The time constant of the
+// baseline is 2^ENVELOPE_BASELINE_SHIFT conversions of the channel.
+const uint32_t ENVELOPE_BASELINE_SHIFT = 12;
+const uint32_t ENVELOPE_BASELINE_BITS = 16;
+
+enum envelope_mode_t : uint8_t
+{
+    ENVELOPE_NONE,
+    ENVELOPE_RECTIFIED,
+    ENVELOPE_RMS,
+    ENVELOPE_MODE_COUNT
+};
+
+struct envelope_detector_t
+{
+    int32_t baseline; // Q16 baseline estimate.
+    uint64_t sum_squares;
+    bool primed;
+};
+
+inline void envelope_reset(envelope_detector_t& envelope)
+{
+    envelope.baseline = 0;
+    envelope.sum_squares = 0;
+    envelope.primed = false;
+}
+
+// Updates the baseline and returns the deviation of the sample from it.
+// The baseline starts at the first sample to avoid a long settling time.
+inline int32_t envelope_deviation(envelope_detector_t& envelope, uint16_t sample)
+{
+    int32_t value = (int32_t)sample << ENVELOPE_BASELINE_BITS;
+    if (!envelope.primed)
+    {
+        envelope.baseline = value;
+        envelope.primed = true;
+    }
+    envelope.baseline += (value - envelope.baseline) >> ENVELOPE_BASELINE_SHIFT;
+    int32_t baseline = (envelope.baseline + (1 << (ENVELOPE_BASELINE_BITS - 1))) >> ENVELOPE_BASELINE_BITS;
+    return (int32_t)sample - baseline;
+}
+
+inline uint16_t envelope_rectify(envelope_detector_t& envelope, uint16_t sample)
+{
+    int32_t deviation = envelope_deviation(envelope, sample);
+    return (uint16_t)(deviation < 0 ? -deviation : deviation);
+}
+
+inline void envelope_accumulate(envelope_detector_t& envelope, uint16_t sample)
+{
+    int32_t deviation = envelope_deviation(envelope, sample);
+    envelope.sum_squares += (uint32_t)(deviation * deviation);
+}
+
+inline uint32_t envelope_isqrt(uint32_t value)
+{
+    uint32_t result = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > value)
+        bit >>= 2;
+    while (bit != 0)
+    {
+        if (value >= result + bit)
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else result >>= 1;
+        bit >>= 2;
+    }
+    return result;
+}
+
+// Returns the root mean square deviation over the specified number of
+// accumulated samples, and starts a new window.
+inline uint16_t envelope_rms(envelope_detector_t& envelope, uint32_t count)
+{
+    uint32_t mean = count > 0 ? (uint32_t)(envelope.sum_squares / count) : 0;
+    envelope.sum_squares = 0;
+    return (uint16_t)envelope_isqrt(mean);
+}
+
+#endif // ENVELOPE_DETECTOR_H
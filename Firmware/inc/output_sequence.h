@@ -0,0 +1,57 @@
+#ifndef OUTPUT_SEQUENCE_H
+#define OUTPUT_SEQUENCE_H
+
+#include <cstdint>
+
+// Compiles a table of (duration, output state) entries into the words fed
+// to the PIO sequence program, i.e. the state of each step followed by the
+// loop count of its delay. Every step spends a fixed number of cycles
+// pulling its words and driving the pins on top of the delay loop. The table
+// ends at the first entry with zero duration, and the clock divider is the
+// smallest integer keeping the longest step in 32 bits. The table register
+// is limited to 30 entries, so its 240 bytes fit in a timestamped message.
+const uint32_t SEQUENCE_MAX_STEPS = 30;
+const uint32_t SEQUENCE_STEP_OVERHEAD = 7;
+const uint32_t SEQUENCE_END_FLAG = 1u << 8;
+const uint32_t SEQUENCE_MAX_CLKDIV = 0xFFFF;
+
+struct sequence_step_t
+{
+    uint32_t state; // Output state, with the end flag set on the final step.
+    uint32_t loops; // Loop count of the step delay.
+};
+
+// Returns the number of steps compiled from the table, or zero if the table
+// is empty or holds a step too short or too long for the state machine.
+// Output states are shifted down so the lowest line maps to the first pin.
+inline uint32_t sequence_compile(const volatile uint32_t* table, uint32_t sys_clock_hz, uint32_t shift,
+                                 sequence_step_t* steps, uint32_t& clkdiv)
+{
+    uint32_t count = 0;
+    uint64_t max_duration_us = 0;
+    while (count < SEQUENCE_MAX_STEPS && table[2 * count] > 0)
+    {
+        if (table[2 * count] > max_duration_us)
+            max_duration_us = table[2 * count];
+        count++;
+    }
+    if (count == 0)
+        return 0;
+
+    uint64_t max_cycles = max_duration_us * sys_clock_hz / 1000000;
+    clkdiv = (uint32_t)(max_cycles >> 32) + 1;
+    if (clkdiv > SEQUENCE_MAX_CLKDIV)
+        return 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint64_t cycles = (uint64_t)table[2 * i] * sys_clock_hz / (1000000ull * clkdiv);
+        if (cycles < SEQUENCE_STEP_OVERHEAD)
+            return 0;
+        steps[i].state = (table[2 * i + 1] & 0xFF) >> shift;
+        steps[i].loops = (uint32_t)(cycles - SEQUENCE_STEP_OVERHEAD);
+    }
+    return count;
+}
+
+#endif // OUTPUT_SEQUENCE_H
@@ -0,0 +1,37 @@
+#ifndef PACKED12_H
+#define PACKED12_H
+
+#include <cstdint>
+
+// Packs 12-bit samples two at a time into three bytes, little-endian:
+// the low byte of the first sample, its high nibble together with the low
+// nibble of the second sample, and the high byte of the second sample.
+// An odd trailing sample takes two bytes.
+
+// Returns the number of bytes required to pack the specified number of samples.
+inline uint32_t pack12_size(uint32_t count)
+{
+    return (3 * count + 1) / 2;
+}
+
+inline void pack12(const uint16_t* samples, uint32_t count, uint8_t* packed)
+{
+    uint32_t i = 0;
+    for (; i + 1 < count; i += 2)
+    {
+        uint16_t first = samples[i] & 0xFFF;
+        uint16_t second = samples[i + 1] & 0xFFF;
+        *packed++ = (uint8_t)first;
+        *packed++ = (uint8_t)((first >> 8) | (second << 4));
+        *packed++ = (uint8_t)(second >> 4);
+    }
+
+    if (i < count)
+    {
+        uint16_t last = samples[i] & 0xFFF;
+        *packed++ = (uint8_t)last;
+        *packed++ = (uint8_t)(last >> 8);
+    }
+}
+
+#endif // PACKED12_H
@@ -0,0 +1,120 @@
+#ifndef PULSE_CHANNELS_H
+#define PULSE_CHANNELS_H
+
+#include <cstdint>
+#include <pulse_timing.h>
+#include <pulse_report.h>
+
+// Bookkeeping of the pulse channels and report records, kept apart from the
+// state machines so the line assignment can be tested on the host. Each output
+// line has one pulse channel, and a train owns the channels of every line in
+// its output mask. Starting a train on a line replaces the train running on it
+// only on that line, so the previous train keeps running on its other lines
+// and stops with the last of them. Every reported train keeps a record until
+// all its pulses are reported, and trains started while every record is
+// pending are not reported.
+const uint32_t PULSE_LINE_COUNT = 8;
+const uint32_t PULSE_REPORT_CAPACITY = 2 * PULSE_LINE_COUNT;
+
+struct pulse_channel_t
+{
+    uint8_t train_mask; // Output mask of the train the line belongs to.
+    uint32_t train_id;
+    uint32_t pulse_period_us;
+    uint32_t pulse_count;     // Pulses per burst, zero if infinite.
+    uint32_t burst_period_us; // Zero for a single burst.
+    uint32_t burst_count;     // Zero if bursts repeat until stopped.
+    uint32_t bursts_queued;
+    uint32_t bursts_done;
+    pulse_timing_t timing;
+    uint64_t start_time_us; // System time of the first rising edge.
+    uint32_t sample_index; // Next pulse reported in AnalogPulseSample.
+    bool active;
+    bool pending; // Configured and waiting for its start time.
+};
+
+struct pulse_report_t
+{
+    uint8_t train_mask;
+    uint32_t train_id;
+    pulse_report_mode_t mode;
+    uint32_t interval;
+    uint32_t pulse_period_us;
+    uint32_t pulse_count;
+    uint32_t burst_period_us;
+    uint32_t burst_count;
+    uint64_t start_time_us; // System time of the first rising edge.
+    uint64_t stop_time_us;  // System time the last line of the train stopped.
+    uint32_t stop_count;    // Pulses generated when the last line stopped.
+    uint32_t next_index;    // Next pulse considered for reporting.
+    bool stopped;
+    bool active;
+};
+
+// Channels and records are statically allocated, so their size is fixed here
+// rather than growing unnoticed with every field added.
+const uint32_t PULSE_STORAGE_BUDGET = 1536;
+static_assert(sizeof(pulse_channel_t) * PULSE_LINE_COUNT + sizeof(pulse_report_t) * PULSE_REPORT_CAPACITY <= PULSE_STORAGE_BUDGET,
+              "pulse channel and report storage exceeds its budget");
+
+// Assigns a line to a new train, which waits for its start time. Any train
+// running on the line must have been released first.
+inline void pulse_channel_assign(pulse_channel_t& channel, uint8_t train_mask, uint32_t train_id,
+                                 uint32_t period_us, uint32_t count, uint32_t burst_period_us,
+                                 uint32_t burst_count, const pulse_timing_t& timing, uint64_t start_time_us)
+{
+    channel.train_mask = train_mask;
+    channel.train_id = train_id;
+    channel.pulse_period_us = period_us;
+    channel.pulse_count = count;
+    channel.burst_period_us = burst_period_us;
+    channel.burst_count = burst_count;
+    channel.bursts_queued = 0;
+    channel.bursts_done = 0;
+    channel.timing = timing;
+    channel.start_time_us = start_time_us;
+    channel.sample_index = 0;
+    channel.active = true;
+    channel.pending = true;
+}
+
+// Releases a line from its train. Returns true if it was the last running
+// line of the train, which then stops.
+inline bool pulse_channel_release(pulse_channel_t* channels, uint32_t line)
+{
+    pulse_channel_t& channel = channels[line];
+    channel.active = false;
+    for (uint32_t i = 0; i < PULSE_LINE_COUNT; i++)
+    {
+        if (channels[i].active && channels[i].train_id == channel.train_id)
+            return false;
+    }
+    return true;
+}
+
+// Returns the index of a free report record, or PULSE_REPORT_CAPACITY if
+// every record is pending.
+inline uint32_t pulse_report_find_free(const pulse_report_t* reports)
+{
+    uint32_t record = 0;
+    while (record < PULSE_REPORT_CAPACITY && reports[record].active)
+        record++;
+    return record;
+}
+
+// Records the stop time and pulse count of a train in its report, if any.
+inline void pulse_report_stop(pulse_report_t* reports, uint32_t train_id, uint64_t stop_time_us, uint64_t stop_count)
+{
+    for (uint32_t i = 0; i < PULSE_REPORT_CAPACITY; i++)
+    {
+        pulse_report_t& report = reports[i];
+        if (report.active && !report.stopped && report.train_id == train_id)
+        {
+            report.stop_time_us = stop_time_us;
+            report.stop_count = stop_count < PULSE_REPORT_NONE_PENDING ? (uint32_t)stop_count : PULSE_REPORT_NONE_PENDING - 1;
+            report.stopped = true;
+        }
+    }
+}
+
+#endif // PULSE_CHANNELS_H
@@ -0,0 +1,72 @@
+#ifndef PULSE_REPORT_H
+#define PULSE_REPORT_H
+
+#include <cstdint>
+#include <pulse_timing.h>
+
+// Reporting policy of pulse trains. Rising edges follow from the start time
+// and period of the train, so reports are computed from the elapsed time
+// rather than raised by the state machine on every pulse.
+enum pulse_report_mode_t : uint8_t
+{
+    PULSE_REPORT_NONE,
+    PULSE_REPORT_START_STOP,
+    PULSE_REPORT_EVERY_NTH,
+    PULSE_REPORT_EVERY_PULSE,
+    PULSE_REPORT_MODE_COUNT
+};
+
+const uint32_t PULSE_REPORT_NONE_PENDING = UINT32_MAX;
+
+// Returns the number of rising edges of a train up to the specified time,
+// limited to the pulse count of finite trains.
+inline uint32_t pulse_report_edges(uint64_t start_time_us, uint32_t period_us, uint32_t count,
+                                   uint32_t burst_period_us, uint32_t burst_count, uint64_t time_us)
+{
+    if (time_us < start_time_us)
+        return 0;
+    uint64_t edges = pulse_edges_elapsed(time_us - start_time_us, period_us, count, burst_period_us);
+    uint64_t limit = pulse_total_count(count, burst_count);
+    if (limit == 0 || limit >= PULSE_REPORT_NONE_PENDING)
+        limit = PULSE_REPORT_NONE_PENDING - 1;
+    return (uint32_t)(edges < limit ? edges : limit);
+}
+
+// Returns the number of pulses generated by a train which stopped after the
+// elapsed time, counting the pulses of the bursts completed in hardware and
+// the rising edges of any burst cut short.
+inline uint64_t pulse_report_count(uint64_t elapsed_us, uint32_t period_us, uint32_t count,
+                                   uint32_t burst_period_us, uint32_t burst_count, uint32_t bursts_done)
+{
+    if (count == 0)
+        return pulse_edges_elapsed(elapsed_us, period_us, count, 0);
+    uint64_t pulses = (uint64_t)bursts_done * count;
+    if (burst_count > 0 && bursts_done >= burst_count)
+        return pulses;
+    uint64_t burst_start_us = (uint64_t)bursts_done * burst_period_us;
+    if (elapsed_us >= burst_start_us)
+        pulses += pulse_edges_elapsed(elapsed_us - burst_start_us, period_us, count, 0);
+    return pulses;
+}
+
+// Returns the first pulse index from the specified one which is reported
+// by the mode, or PULSE_REPORT_NONE_PENDING if there is none.
+inline uint32_t pulse_report_next(pulse_report_mode_t mode, uint32_t interval, uint32_t index)
+{
+    switch (mode)
+    {
+        case PULSE_REPORT_START_STOP:
+            return index == 0 ? 0 : PULSE_REPORT_NONE_PENDING;
+        case PULSE_REPORT_EVERY_NTH:
+        {
+            uint64_t next = ((uint64_t)index + interval - 1) / interval * interval;
+            return next < PULSE_REPORT_NONE_PENDING ? (uint32_t)next : PULSE_REPORT_NONE_PENDING;
+        }
+        case PULSE_REPORT_EVERY_PULSE:
+            return index;
+        default:
+            return PULSE_REPORT_NONE_PENDING;
+    }
+}
+
+#endif // PULSE_REPORT_H
@@ -0,0 +1,112 @@
+#ifndef PULSE_TIMING_H
+#define PULSE_TIMING_H
+
+#include <cstdint>
+
+// Timing of the PIO pulse train program. Each phase is a countdown loop of
+// one cycle per iteration, plus a fixed number of cycles spent driving the
+// pins and reloading the loop counter. The low phase of finite trains also
+// includes the pulse counter, and finite trains are played in bursts separated
+// by a gap which also includes loading the next burst. Phases are given to the
+// program as loop counts, so the clock divider is the smallest integer keeping
+// both the pulse and burst periods in 32 bits.
+const uint32_t PULSE_HIGH_OVERHEAD = 3;
+const uint32_t PULSE_LOW_OVERHEAD = 4;
+const uint32_t PULSE_INFINITE_LOW_OVERHEAD = 3;
+const uint32_t PULSE_GAP_OVERHEAD = 7;
+const uint32_t PULSE_MAX_CLKDIV = 0xFFFF;
+
+// The burst after next is loaded at the end of every burst, so it must be in
+// the FIFO before the next burst ends or the state machine stalls and the gap
+// stretches. The end of burst interrupt may wait behind the DMA interrupt
+// processing a whole ADC block of up to 1 ms, so burst periods are limited to
+// twice that latency.
+const uint32_t PULSE_MIN_BURST_PERIOD_US = 2000;
+
+struct pulse_timing_t
+{
+    uint32_t clkdiv;     // Integer state machine clock divider.
+    uint32_t high_loops; // Loop count of the high phase.
+    uint32_t low_loops;  // Loop count of the low phase.
+    uint32_t gap_loops;  // Loop count of the gap between bursts.
+};
+
+// Converts microseconds into state machine cycles at the specified divider.
+inline uint64_t pulse_us_to_cycles(uint32_t time_us, uint32_t sys_clock_hz, uint32_t clkdiv)
+{
+    return (uint64_t)time_us * sys_clock_hz / (1000000ull * clkdiv);
+}
+
+// Computes the state machine timing of a pulse train with the specified
+// pulse count, or zero if infinite, repeated in bursts starting every burst
+// period, or zero for a single burst. Returns false if the pulse is empty,
+// does not fit within the period, the burst does not fit within the burst
+// period, the burst period is shorter than the reload latency allows, or any
+// phase is too short for the program overhead.
+inline bool pulse_compute_timing(uint32_t sys_clock_hz, uint32_t width_us, uint32_t period_us,
+                                 uint32_t count, uint32_t burst_period_us, pulse_timing_t& timing)
+{
+    if (width_us == 0 || width_us >= period_us)
+        return false;
+
+    uint32_t longest_us = burst_period_us > period_us ? burst_period_us : period_us;
+    uint64_t longest_cycles = pulse_us_to_cycles(longest_us, sys_clock_hz, 1);
+    uint64_t clkdiv = (longest_cycles >> 32) + 1;
+    if (clkdiv > PULSE_MAX_CLKDIV)
+        return false;
+
+    uint32_t low_overhead = count == 0 ? PULSE_INFINITE_LOW_OVERHEAD : PULSE_LOW_OVERHEAD;
+    uint64_t period_cycles = pulse_us_to_cycles(period_us, sys_clock_hz, clkdiv);
+    uint64_t high_cycles = pulse_us_to_cycles(width_us, sys_clock_hz, clkdiv);
+    uint64_t low_cycles = period_cycles - high_cycles;
+    if (high_cycles < PULSE_HIGH_OVERHEAD || low_cycles < low_overhead)
+        return false;
+
+    // The gap runs from the end of the last pulse to the start of the next burst
+    uint64_t gap_cycles = PULSE_GAP_OVERHEAD;
+    if (count > 0 && burst_period_us > 0)
+    {
+        if (burst_period_us < PULSE_MIN_BURST_PERIOD_US)
+            return false;
+        uint64_t burst_cycles = (uint64_t)count * period_cycles;
+        gap_cycles = pulse_us_to_cycles(burst_period_us, sys_clock_hz, clkdiv);
+        if (gap_cycles < burst_cycles + PULSE_GAP_OVERHEAD)
+            return false;
+        gap_cycles -= burst_cycles;
+    }
+
+    timing.clkdiv = (uint32_t)clkdiv;
+    timing.high_loops = (uint32_t)(high_cycles - PULSE_HIGH_OVERHEAD);
+    timing.low_loops = (uint32_t)(low_cycles - low_overhead);
+    timing.gap_loops = (uint32_t)(gap_cycles - PULSE_GAP_OVERHEAD);
+    return true;
+}
+
+// Returns the number of pulses of a train, or zero if it runs until stopped.
+inline uint64_t pulse_total_count(uint32_t count, uint32_t burst_count)
+{
+    return (uint64_t)count * burst_count;
+}
+
+// Returns the offset of a rising edge from the start of the train, with
+// pulses numbered across bursts. Single bursts have a zero burst period.
+inline uint64_t pulse_edge_offset_us(uint64_t index, uint32_t period_us, uint32_t count, uint32_t burst_period_us)
+{
+    if (count == 0 || burst_period_us == 0)
+        return index * period_us;
+    return index / count * burst_period_us + index % count * period_us;
+}
+
+// Returns the number of rising edges from the start of a train up to the
+// elapsed time, regardless of the number of bursts.
+inline uint64_t pulse_edges_elapsed(uint64_t elapsed_us, uint32_t period_us, uint32_t count, uint32_t burst_period_us)
+{
+    if (count == 0)
+        return elapsed_us / period_us + 1;
+    if (burst_period_us == 0)
+        return elapsed_us / period_us < count ? elapsed_us / period_us + 1 : count;
+    uint64_t burst_edges = elapsed_us % burst_period_us / period_us + 1;
+    return elapsed_us / burst_period_us * count + (burst_edges < count ? burst_edges : count);
+}
+
+#endif // PULSE_TIMING_H
@@ -0,0 +1,52 @@
+#ifndef PWM_TIMING_H
+#define PWM_TIMING_H
+
+#include <cstdint>
+
+// Timing of a PWM slice. The counter runs from zero up to the wrap value on
+// a fractional clock divider with four fractional bits, so the divider is the
+// smallest one keeping the period within the 16-bit counter, which leaves the
+// most counts for the duty cycle. Duty cycles are given in hundredths of a
+// percent, and a full duty cycle sets a level above the wrap value so the
+// output stays high, which must also fit in 16 bits.
+const uint32_t PWM_COUNTER_RANGE = 0xFFFF;
+const uint32_t PWM_MIN_CLKDIV_16 = 1 << 4;
+const uint32_t PWM_MAX_CLKDIV_16 = (256 << 4) - 1;
+const uint32_t PWM_DUTY_FULL_SCALE = 10000;
+
+struct pwm_timing_t
+{
+    uint32_t clkdiv_16; // Clock divider in sixteenths.
+    uint32_t wrap;      // Counter wrap value, one less than the period in counts.
+};
+
+// Computes the slice timing of a PWM frequency. Returns false if the
+// frequency is too low for the divider or too high for two counts per period.
+inline bool pwm_compute_timing(uint32_t sys_clock_hz, uint32_t frequency_hz, pwm_timing_t& timing)
+{
+    if (frequency_hz == 0)
+        return false;
+
+    uint64_t period_16 = (uint64_t)sys_clock_hz * 16 / frequency_hz;
+    uint64_t clkdiv_16 = (period_16 + PWM_COUNTER_RANGE - 1) / PWM_COUNTER_RANGE;
+    if (clkdiv_16 < PWM_MIN_CLKDIV_16)
+        clkdiv_16 = PWM_MIN_CLKDIV_16;
+    if (clkdiv_16 > PWM_MAX_CLKDIV_16)
+        return false;
+
+    uint64_t counts = (period_16 + clkdiv_16 / 2) / clkdiv_16;
+    if (counts < 2)
+        return false;
+
+    timing.clkdiv_16 = (uint32_t)clkdiv_16;
+    timing.wrap = (uint32_t)(counts - 1);
+    return true;
+}
+
+// Returns the channel level producing the specified duty cycle.
+inline uint32_t pwm_duty_level(const pwm_timing_t& timing, uint32_t duty_cycle)
+{
+    return (uint32_t)(((uint64_t)(timing.wrap + 1) * duty_cycle + PWM_DUTY_FULL_SCALE / 2) / PWM_DUTY_FULL_SCALE);
+}
+
+#endif // PWM_TIMING_H
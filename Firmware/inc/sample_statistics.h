@@ -0,0 +1,39 @@
+#ifndef SAMPLE_STATISTICS_H
+#define SAMPLE_STATISTICS_H
+
+#include <cstdint>
+
+// Running minimum, maximum and sum of 12-bit samples, updated incrementally
+// so no raw samples need to be kept. The sum holds at least one million
+// full-scale samples before overflowing, which covers a full second of
+// conversions at the maximum ADC rate.
+struct sample_statistics_t
+{
+    uint16_t minimum;
+    uint16_t maximum;
+    uint32_t sum;
+};
+
+inline void statistics_reset(sample_statistics_t& stats)
+{
+    stats.minimum = UINT16_MAX;
+    stats.maximum = 0;
+    stats.sum = 0;
+}
+
+inline void statistics_update(sample_statistics_t& stats, uint16_t sample)
+{
+    if (sample < stats.minimum)
+        stats.minimum = sample;
+    if (sample > stats.maximum)
+        stats.maximum = sample;
+    stats.sum += sample;
+}
+
+// Returns the mean of the specified number of samples, rounded to the nearest unit.
+inline uint16_t statistics_mean(const sample_statistics_t& stats, uint32_t count)
+{
+    return (uint16_t)((stats.sum + count / 2) / count);
+}
+
+#endif // SAMPLE_STATISTICS_H
@@ -0,0 +1,70 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free single-producer single-consumer queue for handing items from an
+// interrupt handler to the main loop without blocking or disabling interrupts.
+// The producer only writes the head index and the consumer only writes the
+// tail index, so each side can run concurrently with the other on one core.
+// Indices run freely and wrap modulo 2^32, so the capacity must be a power of
+// two and every slot can be used.
+template <typename T, uint32_t Capacity>
+struct spsc_queue_t
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "Queue capacity must be a power of two.");
+
+    T items[Capacity];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+};
+
+template <typename T, uint32_t Capacity>
+inline void spsc_queue_reset(spsc_queue_t<T, Capacity>& queue)
+{
+    queue.head = 0;
+    queue.tail = 0;
+}
+
+template <typename T, uint32_t Capacity>
+inline uint32_t spsc_queue_level(const spsc_queue_t<T, Capacity>& queue)
+{
+    return queue.head - queue.tail;
+}
+
+// Adds an item to the queue. Returns false if the queue is full.
+// Must only be called from the producer context.
+template <typename T, uint32_t Capacity>
+inline bool spsc_queue_try_add(spsc_queue_t<T, Capacity>& queue, const T& item)
+{
+    uint32_t head = queue.head;
+    if (head - queue.tail >= Capacity)
+        return false;
+
+    // Publish the item contents before making the slot visible to the consumer
+    queue.items[head & (Capacity - 1)] = item;
+    std::atomic_signal_fence(std::memory_order_release);
+    queue.head = head + 1;
+    return true;
+}
+
+// Removes the oldest item from the queue. Returns false if the queue is empty.
+// Must only be called from the consumer context.
+template <typename T, uint32_t Capacity>
+inline bool spsc_queue_try_remove(spsc_queue_t<T, Capacity>& queue, T& item)
+{
+    uint32_t tail = queue.tail;
+    if (queue.head == tail)
+        return false;
+
+    // Read the item contents before releasing the slot back to the producer
+    std::atomic_signal_fence(std::memory_order_acquire);
+    item = queue.items[tail & (Capacity - 1)];
+    std::atomic_signal_fence(std::memory_order_release);
+    queue.tail = tail + 1;
+    return true;
+}
+
+#endif // SPSC_QUEUE_H
@@ -0,0 +1,42 @@
+#ifndef THRESHOLD_DETECTOR_H
+#define THRESHOLD_DETECTOR_H
+
+#include <cstdint>
+
+// Level crossing detector with hysteresis. The state rises when a sample
+// reaches the threshold, and falls only once a sample drops below the
+// threshold minus the hysteresis, so noise around the threshold does not
+// produce a burst of crossings.
+struct threshold_detector_t
+{
+    uint16_t rising;  // Samples at or above this level set the state.
+    uint16_t falling; // Samples below this level clear the state.
+    bool above;
+};
+
+// Configures the detector levels while preserving its current state.
+// The falling level is clamped at zero if the hysteresis exceeds the threshold.
+inline void threshold_configure(threshold_detector_t& detector, uint16_t threshold, uint16_t hysteresis)
+{
+    detector.rising = threshold;
+    detector.falling = hysteresis < threshold ? threshold - hysteresis : 0;
+}
+
+inline void threshold_reset(threshold_detector_t& detector)
+{
+    detector.above = false;
+}
+
+// Updates the detector state with a new sample.
+// Returns true if the sample crossed the threshold in either direction.
+inline bool threshold_update(threshold_detector_t& detector, uint16_t sample)
+{
+    bool above = detector.above ? sample >= detector.falling : sample >= detector.rising;
+    if (above == detector.above)
+        return false;
+
+    detector.above = above;
+    return true;
+}
+
+#endif // THRESHOLD_DETECTOR_H
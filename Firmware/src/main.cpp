@@ -6,7 +6,30 @@
 #include <hardware/gpio.h>
 #include <hardware/adc.h>
 #include <hardware/dma.h>
-#include <pico/util/queue.h>
+#include <hardware/sync.h>
+#include <hardware/flash.h>
+#include <hardware/pio.h>
+#include <hardware/pwm.h>
+#include <hardware/timer.h>
+#include <hardware/clocks.h>
+#include <adc_timing.h>
+#include <cic_filter.h>
+#include <adc_channels.h>
+#include <spsc_queue.h>
+#include <threshold_detector.h>
+#include <sample_statistics.h>
+#include <adc_calibration.h>
+#include <biquad_filter.h>
+#include <packed12.h>
+#include <delta_codec.h>
+#include <envelope_detector.h>
+#include <pulse_timing.h>
+#include <pulse_report.h>
+#include <pulse_channels.h>
+#include <output_sequence.h>
+#include <pwm_timing.h>
+#include <pulse_train.pio.h>
+#include <output_sequence.pio.h>
 
 // Create device name array.
 const uint16_t who_am_i = 123;
@@ -27,201 +50,1925 @@ const uint32_t AI0_PIN = 26;
 const uint32_t AI1_PIN = 27;
 const uint32_t AI2_PIN = 28;
 const uint32_t AI_MASK = 0x7;
+const uint32_t AI_CHANNEL_COUNT = 4; // AI0-AI2 and the temperature sensor.
+const uint32_t AI_TEMPERATURE_INDEX = 3;
 
 // Harp App state.
 bool events_active = false;
 
-// Repeating timers for pulse control
-const size_t pulse_train_count = 256;
-struct pulse_train_t
+// Forward declarations for restarting acquisition from register writes.
+void enable_adc_events();
+void disable_adc_events();
+void resync_adc();
+
+// Pulse trains are generated by PIO state machines, so every edge is timed in
+// hardware and the CPU only handles the start and end of each train. Each
+// output line has a dedicated pulse channel, lines 0-3 on PIO0 and lines 4-7
+// on PIO1, and a train starts the channels of all lines in its output mask.
+// Finite trains are played in bursts loaded into the FIFO of the state machine
+// ahead of time, so the gap between bursts is also timed in hardware and the
+// CPU only loads the burst after next at the end of every burst. That load
+// must land before the next burst ends, which bounds the burst period.
+// Starting a train replaces any train running on the same lines, and stopping
+// affects only the specified lines, following the bookkeeping in
+// pulse_channels.h. Scheduled trains are started by a dedicated hardware alarm
+// set to the earliest start time of the trains waiting, whose interrupt has
+// the highest priority so a start is not held back by the DMA interrupt and
+// never busy waits within it.
+const uint32_t DO_LINE_COUNT = PULSE_LINE_COUNT;
+int pulse_start_alarm;
+const uint32_t pulse_pio_count = 2;
+uint pulse_program_offset[pulse_pio_count];
+pulse_channel_t pulse_channels[DO_LINE_COUNT];
+uint32_t pulse_train_id;
+
+// Pulse train reports follow the policy set when each train starts. Every
+// reported train keeps a record until the main loop has reported all its
+// pulses up to the time its last line stopped, followed by its summary, so
+// a train can be replaced without losing the reports of the previous one.
+// Trains started while every record is pending are not reported, and are
+// counted in PulseTrainReportOverrun. The pulse count of a stopped train is taken from
+// the bursts its state machines completed, so it matches the pulses generated.
+const uint32_t pulse_report_batch = 16; // Pulses reported per train and main loop iteration.
+pulse_report_t pulse_reports[PULSE_REPORT_CAPACITY];
+
+// Output sequences are played by a PIO state machine fed by DMA, so every
+// step is timed in hardware and the CPU only handles the start and end of
+// playback. The sequence runs on the state machine of its lowest line with
+// the OUT range spanning up to its highest line, so a sequence and a train
+// cannot run on overlapping spans and starting one stops the other. The data
+// channel feeds the steps to the state machine and chains to the control
+// channel, which reloads it from a list of blocks holding the transfer count
+// and read address of every loop, followed by the final step raising the
+// end of sequence interrupt and a null trigger ending the chain.
+const uint32_t sequence_max_loops = 255;
+struct output_sequence_t
+{
+    uint8_t output_mask;
+    uint8_t span_mask; // Lines from the lowest to the highest line of the sequence.
+    uint32_t line;     // Lowest line, whose state machine plays the sequence.
+    bool active;
+};
+output_sequence_t output_sequence;
+uint sequence_program_offset[pulse_pio_count];
+sequence_step_t sequence_steps[SEQUENCE_MAX_STEPS];
+sequence_step_t sequence_end_step;
+uint32_t sequence_blocks[2 * (sequence_max_loops + 2)];
+int sequence_data_channel;
+int sequence_ctrl_channel;
+
+// Output lines in PWM mode are driven by the PWM slices, which map GP15-GP22
+// onto channels 7B, 0A, 0B, 1A, 1B, 2A, 2B and 3A. Lines 1-2, 3-4 and 5-6
+// share the counter of their slice, so they must use the same frequency while
+// both are in PWM mode. Channel levels and wrap values are double buffered,
+// so duty cycle and frequency updates take effect at the end of the period.
+const uint32_t pwm_default_frequency = 1000;
+const uint16_t pwm_default_duty_cycle = PWM_DUTY_FULL_SCALE / 2;
+
+// Lines taken out of PWM mode by trains and sequences, which may start from
+// interrupts, are reported from the main loop with the current PwmEnable.
+volatile bool pwm_enable_changed;
+
+// DMA ring buffer for hardware-paced ADC sampling. The sample channel wraps
+// its write address around the ring and raises an interrupt after every
+// block of conversions, after which the control channel retriggers it.
+// The ring must be aligned to its size in bytes for DMA address wrapping.
+const uint32_t adc_ring_bits = 14;
+const uint32_t adc_ring_length = (1u << adc_ring_bits) / sizeof(uint16_t);
+const uint32_t adc_block_capacity = 1024;
+const uint32_t adc_block_period_us = 1000;
+const uint32_t adc_reflex_block_period_us = 20;
+uint16_t adc_ring[adc_ring_length] __attribute__((aligned(1u << adc_ring_bits)));
+uint32_t adc_ring_index;
+const uint32_t adc_default_sample_rate = 250;
+const uint8_t adc_default_channel_enable = AI_MASK;
+adc_frame_layout_t adc_layout;
+const uint32_t adc_default_start_delay_us = 0;
+const uint32_t adc_max_start_delay_us = 10000000;
+const uint32_t adc_queue_length = 256;
+adc_timing_t adc_timing;
+uint32_t adc_block_length;
+uint32_t adc_pending_block_length;
+
+// Time from enabling acquisition until the first frame is available,
+// reported once per start with the timestamp of that frame.
+uint64_t adc_enable_time_us;
+bool adc_first_frame_pending;
+volatile bool adc_start_latency_ready;
+uint64_t adc_start_latency_timestamp;
+
+// Running conversion counter used to reconstruct the sample time of each
+// frame from the start of acquisition and the known ADC clock. The counter
+// advances with the ring position of the DMA, so it cannot drift from it.
+uint64_t adc_start_time_us;
+uint64_t adc_conversion_count;
+uint64_t adc_frame_start;
+alarm_id_t adc_start_alarm;
+int adc_sample_channel;
+int adc_ctrl_channel;
+
+// Decimation filters used to fold every conversion into the reported frames
+const uint16_t adc_default_decimation = 1;
+const uint16_t adc_max_decimation = 1024;
+const uint8_t adc_default_filter_order = 1;
+cic_filter_t adc_filters[AI_CHANNEL_COUNT];
+uint64_t adc_filter_gain;
+uint32_t adc_filter_order;
+uint32_t adc_settle_frames;
+uint32_t adc_channel_index;
+uint32_t adc_scan_count;
+
+// Per-channel calibration applied to every conversion, indexed by scan position.
+// Calibration registers are persisted in the last sector of flash, well clear
+// of the program image.
+adc_calibration_t adc_calibration[AI_CHANNEL_COUNT];
+const uint32_t calibration_flash_offset = PICO_FLASH_SIZE_BYTES - FLASH_SECTOR_SIZE;
+const uint32_t calibration_magic = 0x4C414341; // "ACAL"
+struct calibration_record_t
+{
+    uint32_t magic;
+    adc_calibration_t channels[AI_CHANNEL_COUNT];
+    uint32_t checksum;
+};
+static_assert(sizeof(calibration_record_t) <= FLASH_PAGE_SIZE,
+              "Calibration record must fit in a single flash page.");
+enum calibration_command_t : uint8_t
+{
+    CALIBRATION_NONE,
+    CALIBRATION_STORE,
+    CALIBRATION_LOAD,
+    CALIBRATION_CLEAR
+};
+
+// Biquad filter cascades run on every conversion ahead of calibration and
+// decimation, indexed by scan position. Each section takes five 64-bit
+// multiplies, a few hundred cycles on the Cortex-M0+, so filtering is limited
+// to conversion rates at which every channel can run both sections within
+// the DMA interrupt and leave time for the rest of the device.
+biquad_cascade_t adc_biquads[AI_CHANNEL_COUNT];
+uint32_t adc_biquad_slots;
+const uint32_t adc_biquad_max_conversion_rate = 100000;
+
+// Statistics accumulated over each frame window when enabled. The enable
+// flag is latched at frame boundaries so every reported window is complete.
+const uint32_t analog_statistics_count = 3; // Minimum, maximum and mean.
+sample_statistics_t adc_statistics[AI_CHANNEL_COUNT];
+bool adc_statistics_enabled;
+
+// Envelope detectors replace the reported value of a channel with its mean
+// rectified or RMS amplitude over each frame window, indexed by scan position.
+envelope_detector_t adc_envelopes[AI_CHANNEL_COUNT];
+uint32_t adc_rectified_slots;
+uint32_t adc_rms_slots;
+
+// Define queue item contents
+#pragma pack(push, 1)
+struct adc_queue_item_t
+{
+    uint64_t timestamp;
+    uint32_t sequence; // Index of the frame since acquisition started.
+    uint16_t analog_data[AI_CHANNEL_COUNT]; // Values of enabled channels in scan order.
+    uint16_t statistics[analog_statistics_count * AI_CHANNEL_COUNT];
+    bool has_statistics;
+};
+#pragma pack(pop)
+adc_queue_item_t adc_queue_current;
+
+// Frames are handed from the DMA interrupt to the main loop through a
+// lock-free queue, so the interrupt never blocks when the host falls behind.
+// Frames which do not fit are dropped and counted in AnalogOverrun, leaving
+// a gap in the frame sequence.
+static spsc_queue_t<adc_queue_item_t, adc_queue_length> adc_queue;
+uint32_t adc_frame_sequence;
+
+// Round-robin resynchronization after conversions are lost to a FIFO overflow,
+// reported once per occurrence with the time of the last consistent conversion.
+volatile bool adc_resync_ready;
+uint64_t adc_resync_timestamp;
+
+// Level crossing detectors evaluated on every conversion, indexed by scan
+// position. Crossings are timestamped at the conversion which caused them.
+threshold_detector_t adc_detectors[AI_CHANNEL_COUNT];
+uint32_t adc_detector_slots;
+uint32_t adc_threshold_slots;
+uint32_t adc_reflex_slots;
+uint8_t adc_threshold_state;
+
+// Reflex actions drive digital outputs directly from the DMA interrupt when
+// a channel crosses its threshold, bypassing the round trip to the host.
+enum reflex_action_t : uint8_t
+{
+    REFLEX_NONE,
+    REFLEX_SET,
+    REFLEX_CLEAR,
+    REFLEX_TOGGLE,
+    REFLEX_FOLLOW,
+    REFLEX_PULSE_TRAIN,
+    REFLEX_ACTION_COUNT
+};
+uint8_t adc_reflex_action[AI_CHANNEL_COUNT];
+uint8_t adc_reflex_output[AI_CHANNEL_COUNT];
+
+// Single-byte register events raised from interrupts, e.g. threshold
+// crossings, reflex actions and output state changes, are sent from the main loop.
+struct adc_event_item_t
+{
+    uint64_t timestamp;
+    uint8_t reg_index;
+    uint8_t value;
+};
+const uint32_t adc_event_queue_length = 64;
+static spsc_queue_t<adc_event_item_t, adc_event_queue_length> adc_event_queue;
+adc_event_item_t adc_event_current;
+
+// Oscilloscope-style capture of raw conversions around a trigger. The DMA ring
+// keeps recording, so the window is copied out as soon as all post-trigger
+// conversions are in, and then streamed to the host in chunks.
+enum capture_state_t : uint8_t
+{
+    CAPTURE_IDLE,
+    CAPTURE_ARMED,
+    CAPTURE_TRIGGERED,
+    CAPTURE_READY
+};
+enum capture_trigger_t : uint8_t
+{
+    CAPTURE_TRIGGER_NONE,
+    CAPTURE_TRIGGER_DIGITAL_INPUT,
+    CAPTURE_TRIGGER_ANALOG_THRESHOLD,
+    CAPTURE_TRIGGER_COUNT
+};
+const uint32_t capture_capacity = 4096;
+static_assert(capture_capacity + 2 * adc_block_capacity <= adc_ring_length,
+              "Capture window must fit in the ring ahead of the DMA write address.");
+const uint16_t capture_default_pre_trigger = 100;
+const uint16_t capture_default_post_trigger = 900;
+uint16_t capture_buffer[capture_capacity];
+volatile uint8_t capture_state;
+uint64_t capture_start;
+uint32_t capture_length;
+uint32_t capture_sent;
+
+// Pulse-locked sampling of the first scan following each rising edge of the
+// selected pulse trains by a fixed delay. Edge times follow from the start of
+// each train and its period, and the scan is looked up in the DMA ring once it
+// is converted, so single values can be picked out without streaming every frame.
+// Pulses whose scans are dropped are counted in AnalogPulseSampleOverrun.
+struct pulse_sample_item_t
+{
+    uint64_t timestamp;
+    uint32_t pulse_index;
+    uint8_t output_mask;
+    uint16_t analog_data[AI_CHANNEL_COUNT]; // Values of enabled channels in scan order.
+};
+const uint32_t pulse_sample_queue_length = 32;
+const uint32_t pulse_sample_block_limit = pulse_sample_queue_length; // Pulses sampled per train and block.
+const uint32_t pulse_sample_header_count = 2; // Output mask and pulse index.
+const uint32_t pulse_sample_max_delay_us = 1000000;
+static spsc_queue_t<pulse_sample_item_t, pulse_sample_queue_length> pulse_sample_queue;
+pulse_sample_item_t pulse_sample_current;
+
+// Batches of consecutive frames reported in a single AnalogDataBatch event.
+// The Harp payload is limited to 255 bytes, so at most 120 values fit, e.g.
+// 40 frames of three channels or 120 frames of a single channel.
+const uint32_t analog_batch_capacity = 120;
+uint32_t analog_batch_frames;
+uint64_t analog_batch_timestamp;
+uint32_t analog_next_sequence;
+
+// Batches can alternatively be reported with two 12-bit values in every
+// three bytes, in which case single frames are reported as batches of one,
+// or delta compressed, in which case a batch size of zero fills each message.
+enum analog_data_format_t : uint8_t
+{
+    ANALOG_FORMAT_UNPACKED,
+    ANALOG_FORMAT_PACKED,
+    ANALOG_FORMAT_COMPRESSED,
+    ANALOG_FORMAT_COUNT
+};
+const uint32_t analog_packed_capacity = analog_batch_capacity * 3 / 2;
+const uint32_t analog_compressed_capacity = analog_batch_capacity * sizeof(uint16_t);
+delta_encoder_t analog_encoder;
+
+// Harp App Register Setup.
+const size_t reg_count = 59;
+
+// Define register contents.
+#pragma pack(push, 1)
+struct app_regs_t
+{
+    volatile uint8_t di_state;
+    volatile uint8_t do_set;
+    volatile uint8_t do_clear;
+    volatile uint8_t do_toggle;
+    volatile uint8_t do_state;
+    volatile uint32_t start_pulse_train[4];
+    volatile uint8_t stop_pulse_train;
+    volatile uint16_t analog_data[AI_CHANNEL_COUNT];
+    volatile uint32_t analog_sample_rate;
+    volatile uint8_t analog_data_batch_size;
+    volatile uint16_t analog_data_batch[analog_batch_capacity];
+    volatile uint16_t analog_decimation;
+    volatile uint8_t analog_filter_order;
+    volatile uint8_t analog_channel_enable;
+    volatile uint32_t analog_overrun;
+    volatile uint8_t analog_threshold_enable;
+    volatile uint16_t analog_threshold[AI_CHANNEL_COUNT];
+    volatile uint16_t analog_hysteresis[AI_CHANNEL_COUNT];
+    volatile uint8_t analog_threshold_crossing;
+    volatile uint8_t analog_data_enable;
+    volatile uint8_t analog_reflex_action[AI_CHANNEL_COUNT];
+    volatile uint8_t analog_reflex_output[AI_CHANNEL_COUNT];
+    volatile uint32_t analog_reflex_pulse_train[3];
+    volatile uint8_t analog_capture_trigger;
+    volatile uint8_t analog_capture_digital_input;
+    volatile uint16_t analog_capture_window[2];
+    volatile uint16_t analog_capture_data[analog_batch_capacity];
+    volatile uint32_t analog_start_delay;
+    volatile uint32_t analog_start_latency;
+    volatile uint8_t analog_statistics_enable;
+    volatile uint16_t analog_statistics[analog_statistics_count * AI_CHANNEL_COUNT];
+    volatile int16_t analog_calibration_offset[AI_CHANNEL_COUNT];
+    volatile uint16_t analog_calibration_gain[AI_CHANNEL_COUNT];
+    volatile uint8_t analog_calibration_command;
+    volatile uint8_t analog_biquad_sections[AI_CHANNEL_COUNT];
+    volatile int32_t analog_biquad_coefficients[AI_CHANNEL_COUNT * BIQUAD_MAX_SECTIONS * BIQUAD_COEFFICIENT_COUNT];
+    volatile uint8_t analog_data_format;
+    volatile uint8_t analog_data_packed[analog_packed_capacity];
+    volatile uint8_t analog_data_compressed[analog_compressed_capacity];
+    volatile uint32_t analog_resync;
+    volatile uint8_t analog_pulse_sample_outputs;
+    volatile uint32_t analog_pulse_sample_delay;
+    volatile uint32_t analog_pulse_sample[pulse_sample_header_count + AI_CHANNEL_COUNT];
+    volatile uint8_t analog_envelope_mode[AI_CHANNEL_COUNT];
+    volatile uint64_t pulse_train_start_time;
+    volatile uint32_t output_sequence[2 * SEQUENCE_MAX_STEPS];
+    volatile uint8_t start_output_sequence[2];
+    volatile uint8_t stop_output_sequence;
+    volatile uint8_t output_sequence_state;
+    volatile uint8_t pwm_enable;
+    volatile uint32_t pwm_frequency[DO_LINE_COUNT];
+    volatile uint16_t pwm_duty_cycle[DO_LINE_COUNT];
+    volatile uint8_t pulse_train_report_mode;
+    volatile uint16_t pulse_train_report_interval;
+    volatile uint32_t pulse_train_pulse[2];
+    volatile uint64_t pulse_train_summary[4];
+    volatile uint32_t pulse_train_burst[2];
+    volatile uint32_t pulse_train_report_overrun;
+    volatile uint32_t analog_pulse_sample_overrun;
+} app_regs;
+#pragma pack(pop)
+
+// Define register "specs."
+RegSpecs app_reg_specs[reg_count]
+{
+    {(uint8_t*)&app_regs.di_state, sizeof(app_regs.di_state), U8},
+    {(uint8_t*)&app_regs.do_set, sizeof(app_regs.do_set), U8},
+    {(uint8_t*)&app_regs.do_clear, sizeof(app_regs.do_clear), U8},
+    {(uint8_t*)&app_regs.do_toggle, sizeof(app_regs.do_toggle), U8},
+    {(uint8_t*)&app_regs.do_state, sizeof(app_regs.do_state), U8},
+    {(uint8_t*)&app_regs.start_pulse_train, sizeof(app_regs.start_pulse_train), U32},
+    {(uint8_t*)&app_regs.stop_pulse_train, sizeof(app_regs.stop_pulse_train), U8},
+    {(uint8_t*)&app_regs.analog_data, sizeof(app_regs.analog_data), U16},
+    {(uint8_t*)&app_regs.analog_sample_rate, sizeof(app_regs.analog_sample_rate), U32},
+    {(uint8_t*)&app_regs.analog_data_batch_size, sizeof(app_regs.analog_data_batch_size), U8},
+    {(uint8_t*)&app_regs.analog_data_batch, sizeof(app_regs.analog_data_batch), U16},
+    {(uint8_t*)&app_regs.analog_decimation, sizeof(app_regs.analog_decimation), U16},
+    {(uint8_t*)&app_regs.analog_filter_order, sizeof(app_regs.analog_filter_order), U8},
+    {(uint8_t*)&app_regs.analog_channel_enable, sizeof(app_regs.analog_channel_enable), U8},
+    {(uint8_t*)&app_regs.analog_overrun, sizeof(app_regs.analog_overrun), U32},
+    {(uint8_t*)&app_regs.analog_threshold_enable, sizeof(app_regs.analog_threshold_enable), U8},
+    {(uint8_t*)&app_regs.analog_threshold, sizeof(app_regs.analog_threshold), U16},
+    {(uint8_t*)&app_regs.analog_hysteresis, sizeof(app_regs.analog_hysteresis), U16},
+    {(uint8_t*)&app_regs.analog_threshold_crossing, sizeof(app_regs.analog_threshold_crossing), U8},
+    {(uint8_t*)&app_regs.analog_data_enable, sizeof(app_regs.analog_data_enable), U8},
+    {(uint8_t*)&app_regs.analog_reflex_action, sizeof(app_regs.analog_reflex_action), U8},
+    {(uint8_t*)&app_regs.analog_reflex_output, sizeof(app_regs.analog_reflex_output), U8},
+    {(uint8_t*)&app_regs.analog_reflex_pulse_train, sizeof(app_regs.analog_reflex_pulse_train), U32},
+    {(uint8_t*)&app_regs.analog_capture_trigger, sizeof(app_regs.analog_capture_trigger), U8},
+    {(uint8_t*)&app_regs.analog_capture_digital_input, sizeof(app_regs.analog_capture_digital_input), U8},
+    {(uint8_t*)&app_regs.analog_capture_window, sizeof(app_regs.analog_capture_window), U16},
+    {(uint8_t*)&app_regs.analog_capture_data, sizeof(app_regs.analog_capture_data), U16},
+    {(uint8_t*)&app_regs.analog_start_delay, sizeof(app_regs.analog_start_delay), U32},
+    {(uint8_t*)&app_regs.analog_start_latency, sizeof(app_regs.analog_start_latency), U32},
+    {(uint8_t*)&app_regs.analog_statistics_enable, sizeof(app_regs.analog_statistics_enable), U8},
+    {(uint8_t*)&app_regs.analog_statistics, sizeof(app_regs.analog_statistics), U16},
+    {(uint8_t*)&app_regs.analog_calibration_offset, sizeof(app_regs.analog_calibration_offset), S16},
+    {(uint8_t*)&app_regs.analog_calibration_gain, sizeof(app_regs.analog_calibration_gain), U16},
+    {(uint8_t*)&app_regs.analog_calibration_command, sizeof(app_regs.analog_calibration_command), U8},
+    {(uint8_t*)&app_regs.analog_biquad_sections, sizeof(app_regs.analog_biquad_sections), U8},
+    {(uint8_t*)&app_regs.analog_biquad_coefficients, sizeof(app_regs.analog_biquad_coefficients), S32},
+    {(uint8_t*)&app_regs.analog_data_format, sizeof(app_regs.analog_data_format), U8},
+    {(uint8_t*)&app_regs.analog_data_packed, sizeof(app_regs.analog_data_packed), U8},
+    {(uint8_t*)&app_regs.analog_data_compressed, sizeof(app_regs.analog_data_compressed), U8},
+    {(uint8_t*)&app_regs.analog_resync, sizeof(app_regs.analog_resync), U32},
+    {(uint8_t*)&app_regs.analog_pulse_sample_outputs, sizeof(app_regs.analog_pulse_sample_outputs), U8},
+    {(uint8_t*)&app_regs.analog_pulse_sample_delay, sizeof(app_regs.analog_pulse_sample_delay), U32},
+    {(uint8_t*)&app_regs.analog_pulse_sample, sizeof(app_regs.analog_pulse_sample), U32},
+    {(uint8_t*)&app_regs.analog_envelope_mode, sizeof(app_regs.analog_envelope_mode), U8},
+    {(uint8_t*)&app_regs.pulse_train_start_time, sizeof(app_regs.pulse_train_start_time), U64},
+    {(uint8_t*)&app_regs.output_sequence, sizeof(app_regs.output_sequence), U32},
+    {(uint8_t*)&app_regs.start_output_sequence, sizeof(app_regs.start_output_sequence), U8},
+    {(uint8_t*)&app_regs.stop_output_sequence, sizeof(app_regs.stop_output_sequence), U8},
+    {(uint8_t*)&app_regs.output_sequence_state, sizeof(app_regs.output_sequence_state), U8},
+    {(uint8_t*)&app_regs.pwm_enable, sizeof(app_regs.pwm_enable), U8},
+    {(uint8_t*)&app_regs.pwm_frequency, sizeof(app_regs.pwm_frequency), U32},
+    {(uint8_t*)&app_regs.pwm_duty_cycle, sizeof(app_regs.pwm_duty_cycle), U16},
+    {(uint8_t*)&app_regs.pulse_train_report_mode, sizeof(app_regs.pulse_train_report_mode), U8},
+    {(uint8_t*)&app_regs.pulse_train_report_interval, sizeof(app_regs.pulse_train_report_interval), U16},
+    {(uint8_t*)&app_regs.pulse_train_pulse, sizeof(app_regs.pulse_train_pulse), U32},
+    {(uint8_t*)&app_regs.pulse_train_summary, sizeof(app_regs.pulse_train_summary), U64},
+    {(uint8_t*)&app_regs.pulse_train_burst, sizeof(app_regs.pulse_train_burst), U32},
+    {(uint8_t*)&app_regs.pulse_train_report_overrun, sizeof(app_regs.pulse_train_report_overrun), U32},
+    {(uint8_t*)&app_regs.analog_pulse_sample_overrun, sizeof(app_regs.analog_pulse_sample_overrun), U32}
+};
+
+void trigger_capture(uint64_t conversion)
+{
+    // Align the window with the start of the scan containing the trigger
+    uint32_t channel_count = adc_layout.channel_count;
+    uint64_t scan_start = conversion - conversion % channel_count;
+    uint64_t pre_trigger = (uint64_t)app_regs.analog_capture_window[0] * channel_count;
+    capture_start = scan_start > pre_trigger ? scan_start - pre_trigger : 0;
+    capture_length = (app_regs.analog_capture_window[0] + app_regs.analog_capture_window[1]) * channel_count;
+    capture_state = CAPTURE_TRIGGERED;
+}
+
+void gpio_callback(uint gpio, uint32_t events)
+{
+    uint32_t gpio_state = gpio_get_all();
+    app_regs.di_state = 0;
+    app_regs.di_state |= (gpio_state & 0xC) >> 2;
+    app_regs.di_state |= (gpio_state & 0x7000) >> 10;
+
+    // Locate the rising edge in the conversion stream from the ADC start time
+    uint32_t input_mask = 1u << (gpio < 4 ? gpio - 2 : gpio - 10);
+    if (capture_state == CAPTURE_ARMED &&
+        app_regs.analog_capture_trigger == CAPTURE_TRIGGER_DIGITAL_INPUT &&
+        (app_regs.analog_capture_digital_input & input_mask) &&
+        (events & GPIO_IRQ_EDGE_RISE))
+    {
+        uint64_t time_us = time_us_64();
+        trigger_capture(time_us > adc_start_time_us ? adc_us_to_conversions(time_us - adc_start_time_us, adc_timing) : 0);
+    }
+    HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS);
+}
+
+void write_do_set(msg_t &msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+    gpio_set_mask(app_regs.do_set << DO0_PIN);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_do_clear(msg_t &msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+    gpio_clr_mask(app_regs.do_clear << DO0_PIN);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_do_toggle(msg_t &msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+    gpio_xor_mask(app_regs.do_toggle << DO0_PIN);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_do_state(msg_t &msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+    gpio_put_masked(DO_MASK, app_regs.do_state << DO0_PIN);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+bool try_queue_event(uint8_t reg_index, uint8_t value, uint64_t timestamp)
+{
+    adc_event_item_t item;
+    item.timestamp = timestamp;
+    item.reg_index = reg_index;
+    item.value = value;
+    return spsc_queue_try_add(adc_event_queue, item);
+}
+
+void queue_adc_event(uint8_t reg_index, uint8_t value, uint64_t timestamp)
+{
+    if (!try_queue_event(reg_index, value, timestamp))
+        app_regs.analog_overrun++;
+}
+
+// Queues an output event raised outside the DMA interrupt, e.g. from the PIO
+// interrupt, which reaches the queue with interrupts disabled so the queue
+// keeps a single producer at a time. Dropped output events are counted with
+// the pulse train reports rather than the analog stream.
+void queue_output_event(uint8_t reg_index, uint8_t value)
+{
+    uint32_t status = save_and_disable_interrupts();
+    if (!try_queue_event(reg_index, value, HarpCore::harp_time_us_64()))
+        app_regs.pulse_train_report_overrun++;
+    restore_interrupts(status);
+}
+
+PIO pulse_channel_pio(uint32_t line)
+{
+    return line < NUM_PIO_STATE_MACHINES ? pio0 : pio1;
+}
+
+uint pulse_channel_sm(uint32_t line)
+{
+    return line % NUM_PIO_STATE_MACHINES;
+}
+
+// Returns the output lines driven by the channels of a PWM slice.
+uint8_t pwm_slice_lines(uint slice)
+{
+    uint8_t slice_mask = 0;
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        if (pwm_gpio_to_slice_num(DO0_PIN + line) == slice)
+            slice_mask |= 1u << line;
+    }
+    return slice_mask;
+}
+
+// Hands PWM lines back to the SIO driven low, and disables the slices left
+// without any line in PWM mode.
+void release_pwm_lines(uint8_t output_mask)
+{
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        if ((output_mask & (1u << line)) == 0)
+            continue;
+        uint pin = DO0_PIN + line;
+        gpio_clr_mask(1u << pin);
+        gpio_set_function(pin, GPIO_FUNC_SIO);
+
+        uint slice = pwm_gpio_to_slice_num(pin);
+        if ((pwm_slice_lines(slice) & app_regs.pwm_enable) == 0)
+            pwm_set_enabled(slice, false);
+    }
+}
+
+// Takes the specified lines out of PWM mode. Returns the lines stopped.
+uint8_t stop_pwm_outputs(uint8_t output_mask)
+{
+    uint32_t status = save_and_disable_interrupts();
+    uint8_t stopped_mask = app_regs.pwm_enable & output_mask;
+    app_regs.pwm_enable &= ~stopped_mask;
+    release_pwm_lines(stopped_mask);
+    restore_interrupts(status);
+    return stopped_mask;
+}
+
+// Records the stop time of a reported train and the pulses generated by its
+// last line, so its pulses are reported up to that count.
+void finish_pulse_report(const pulse_channel_t& channel)
+{
+    uint64_t stop_time_us = time_us_64();
+    uint64_t stop_count = 0;
+    if (!channel.pending && stop_time_us >= channel.start_time_us)
+        stop_count = pulse_report_count(stop_time_us - channel.start_time_us, channel.pulse_period_us,
+                                        channel.pulse_count, channel.burst_period_us,
+                                        channel.burst_count, channel.bursts_done);
+    pulse_report_stop(pulse_reports, channel.train_id, stop_time_us, stop_count);
+}
+
+// Stops the pulse channel of a line and hands it back to the SIO, driven low.
+// Returns the line mask if a train was running on it.
+uint8_t stop_pulse_channel(uint32_t line)
+{
+    pulse_channel_t& channel = pulse_channels[line];
+    if (!channel.active)
+        return 0;
+
+    pio_sm_set_enabled(pulse_channel_pio(line), pulse_channel_sm(line), false);
+    gpio_clr_mask(1u << (DO0_PIN + line));
+    gpio_set_function(DO0_PIN + line, GPIO_FUNC_SIO);
+
+    // The train stops with its last running line
+    if (pulse_channel_release(pulse_channels, line))
+        finish_pulse_report(channel);
+    channel.pending = false;
+    return 1u << line;
+}
+
+// Stops the trains running on the specified lines. Returns the lines stopped.
+uint8_t stop_pulse_trains(uint8_t output_mask)
+{
+    uint8_t stopped_mask = 0;
+    uint32_t status = save_and_disable_interrupts();
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        if (output_mask & (1u << line))
+            stopped_mask |= stop_pulse_channel(line);
+    }
+    restore_interrupts(status);
+    return stopped_mask;
+}
+
+// Trains are also stopped from interrupts, so the lines stopped are reported
+// from the main loop.
+void report_stopped_pulse_trains(uint8_t stopped_mask)
+{
+    if (stopped_mask)
+        queue_output_event(6, stopped_mask);
+}
+
+// Sequences are also stopped from interrupts, so state changes are reported
+// from the main loop.
+void report_output_sequence_state(uint8_t output_mask)
+{
+    app_regs.output_sequence_state = output_mask;
+    queue_output_event(48, output_mask);
+}
+
+// Stops the sequence and hands its lines back to the SIO, holding the state
+// they were last driven to. Returns the lines of the sequence if it was playing.
+uint8_t stop_output_sequence()
+{
+    if (!output_sequence.active)
+        return 0;
+
+    // Note: loop is needed since dma_channel_abort does not wait for CHAN_ABORT
+    // https://github.com/raspberrypi/pico-sdk/issues/923
+    uint32_t status = save_and_disable_interrupts();
+    while (dma_channel_is_busy(sequence_ctrl_channel) || dma_channel_is_busy(sequence_data_channel)) {
+        dma_channel_abort(sequence_ctrl_channel);
+        dma_channel_abort(sequence_data_channel);
+    }
+    PIO pio = pulse_channel_pio(output_sequence.line);
+    uint sm = pulse_channel_sm(output_sequence.line);
+    pio_sm_set_enabled(pio, sm, false);
+    pio_interrupt_clear(pio, sm);
+
+    gpio_put_masked((uint32_t)output_sequence.output_mask << DO0_PIN, gpio_get_all());
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        if (output_sequence.output_mask & (1u << line))
+            gpio_set_function(DO0_PIN + line, GPIO_FUNC_SIO);
+    }
+    output_sequence.active = false;
+    restore_interrupts(status);
+    return output_sequence.output_mask;
+}
+
+// Starts playing the sequence table on the lines in the output mask, the
+// specified number of times or until stopped if zero. Replaces any sequence
+// and stops the trains running on the lines it spans, returning them in
+// stopped_mask. Returns false if the table is empty or its timing is invalid.
+bool start_output_sequence(uint8_t output_mask, uint32_t loops, uint8_t& stopped_mask)
+{
+    stopped_mask = 0;
+    if (output_mask == 0)
+        return false;
+
+    uint32_t line = __builtin_ctz(output_mask);
+    uint32_t span = 32 - __builtin_clz(output_mask) - line;
+    sequence_step_t steps[SEQUENCE_MAX_STEPS];
+    uint32_t clkdiv;
+    uint32_t step_count = sequence_compile(app_regs.output_sequence, clock_get_hz(clk_sys), line, steps, clkdiv);
+    if (step_count == 0)
+        return false;
+
+    if (stop_pwm_outputs(output_mask))
+        pwm_enable_changed = true;
+
+    uint32_t status = save_and_disable_interrupts();
+    uint8_t span_mask = ((1u << span) - 1) << line;
+    stop_output_sequence();
+    stopped_mask = stop_pulse_trains(span_mask);
+    memcpy(sequence_steps, steps, step_count * sizeof(sequence_step_t));
+    sequence_end_step.state = steps[step_count - 1].state | SEQUENCE_END_FLAG;
+    sequence_end_step.loops = 0;
+
+    PIO pio = pulse_channel_pio(line);
+    uint sm = pulse_channel_sm(line);
+    uint offset = sequence_program_offset[line / NUM_PIO_STATE_MACHINES];
+    pio_sm_config config = output_sequence_program_get_default_config(offset);
+    sm_config_set_out_pins(&config, DO0_PIN + line, span);
+    sm_config_set_out_shift(&config, true, false, 32);
+    sm_config_set_clkdiv_int_frac(&config, clkdiv, 0);
+    pio_sm_init(pio, sm, offset, &config);
+    pio_interrupt_clear(pio, sm);
+
+    // Hand the lines over to the PIO holding their state until the first step
+    uint32_t pin_mask = (uint32_t)output_mask << DO0_PIN;
+    pio_sm_set_pins_with_mask(pio, sm, gpio_get_all(), pin_mask);
+    pio_sm_set_pindirs_with_mask(pio, sm, pin_mask, pin_mask);
+    for (uint32_t i = line; i < DO_LINE_COUNT; i++)
+    {
+        if (output_mask & (1u << i))
+            pio_gpio_init(pio, DO0_PIN + i);
+    }
+
+    uint32_t step_words = step_count * sizeof(sequence_step_t) / sizeof(uint32_t);
+    dma_channel_config data_config = dma_channel_get_default_config(sequence_data_channel);
+    channel_config_set_transfer_data_size(&data_config, DMA_SIZE_32);
+    channel_config_set_read_increment(&data_config, true);
+    channel_config_set_write_increment(&data_config, false);
+    channel_config_set_dreq(&data_config, pio_get_dreq(pio, sm, true));
+    channel_config_set_chain_to(&data_config, sequence_ctrl_channel);
+    dma_channel_configure(sequence_data_channel, &data_config, &pio->txf[sm], sequence_steps, step_words, false);
+
+    // Sequences looping until stopped only need the read address rewound, so
+    // the control channel writes it alone and leaves the transfer count as is
+    dma_channel_config ctrl_config = dma_channel_get_default_config(sequence_ctrl_channel);
+    channel_config_set_transfer_data_size(&ctrl_config, DMA_SIZE_32);
+    volatile dma_channel_hw_t* data_hw = &dma_hw->ch[sequence_data_channel];
+    if (loops == 0)
+    {
+        sequence_blocks[0] = (uint32_t)(uintptr_t)sequence_steps;
+        channel_config_set_read_increment(&ctrl_config, false);
+        channel_config_set_write_increment(&ctrl_config, false);
+        dma_channel_configure(sequence_ctrl_channel, &ctrl_config, &data_hw->al3_read_addr_trig,
+                              sequence_blocks, 1, false);
+    }
+    else
+    {
+        uint32_t* block = sequence_blocks;
+        for (uint32_t i = 0; i < loops; i++)
+        {
+            *block++ = step_words;
+            *block++ = (uint32_t)(uintptr_t)sequence_steps;
+        }
+        *block++ = sizeof(sequence_end_step) / sizeof(uint32_t);
+        *block++ = (uint32_t)(uintptr_t)&sequence_end_step;
+        *block++ = 0;
+        *block++ = 0;
+
+        // Each block is written to the transfer count and read address
+        // trigger, wrapping the write address over the pair of registers
+        channel_config_set_read_increment(&ctrl_config, true);
+        channel_config_set_write_increment(&ctrl_config, true);
+        channel_config_set_ring(&ctrl_config, true, 3);
+        dma_channel_configure(sequence_ctrl_channel, &ctrl_config, &data_hw->al3_transfer_count,
+                              sequence_blocks, 2, false);
+    }
+
+    output_sequence.output_mask = output_mask;
+    output_sequence.span_mask = span_mask;
+    output_sequence.line = line;
+    output_sequence.active = true;
+    dma_channel_start(sequence_ctrl_channel);
+    pio_sm_set_enabled(pio, sm, true);
+    restore_interrupts(status);
+    return true;
+}
+
+// Loads the next burst of a channel into the FIFO of its state machine.
+void queue_pulse_burst(uint32_t line)
+{
+    pulse_channel_t& channel = pulse_channels[line];
+    PIO pio = pulse_channel_pio(line);
+    uint sm = pulse_channel_sm(line);
+    pio_sm_put(pio, sm, channel.pulse_count > 0 ? channel.pulse_count - 1 : 0);
+    pio_sm_put(pio, sm, channel.timing.low_loops);
+    pio_sm_put(pio, sm, channel.timing.gap_loops);
+    channel.bursts_queued++;
+}
+
+// Counts a burst played by a channel and loads the burst after next, which
+// leaves the whole of the next burst to load it. Returns the line mask if the
+// train has played its last burst and the line is stopped.
+uint8_t end_pulse_burst(uint32_t line)
+{
+    pulse_channel_t& channel = pulse_channels[line];
+    if (!channel.active)
+        return 0;
+
+    channel.bursts_done++;
+    if (channel.burst_count > 0 && channel.bursts_done >= channel.burst_count)
+        return stop_pulse_channel(line);
+    if (channel.burst_count == 0 || channel.bursts_queued < channel.burst_count)
+        queue_pulse_burst(line);
+    return 0;
+}
+
+// Enables the channels of a train together. Lines on the same PIO block start
+// on the same cycle, but the two blocks are enabled by separate writes, so a
+// train spanning lines 0-3 and 4-7 starts the upper lines a few system clock
+// cycles later, which is under 100 ns at the default clock.
+void enable_pulse_train(uint32_t train_id)
+{
+    uint32_t sm_mask[pulse_pio_count] = {};
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        pulse_channel_t& channel = pulse_channels[line];
+        if (channel.pending && channel.train_id == train_id)
+        {
+            sm_mask[line / NUM_PIO_STATE_MACHINES] |= 1u << pulse_channel_sm(line);
+            channel.pending = false;
+        }
+    }
+    pio_enable_sm_mask_in_sync(pio0, sm_mask[0]);
+    pio_enable_sm_mask_in_sync(pio1, sm_mask[1]);
+}
+
+// Starts the trains whose start time has come, and sets the start alarm to
+// the earliest start time of the trains still waiting. The alarm is not
+// raised if its target passes while it is set, so the trains are checked again.
+void start_pending_pulse_trains()
+{
+    while (true)
+    {
+        uint64_t time_us = time_us_64();
+        uint64_t next_start_us = UINT64_MAX;
+        for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+        {
+            pulse_channel_t& channel = pulse_channels[line];
+            if (!channel.pending)
+                continue;
+            if (channel.start_time_us <= time_us)
+                enable_pulse_train(channel.train_id);
+            else if (channel.start_time_us < next_start_us)
+                next_start_us = channel.start_time_us;
+        }
+        if (next_start_us == UINT64_MAX ||
+            !hardware_alarm_set_target(pulse_start_alarm, from_us_since_boot(next_start_us)))
+            return;
+    }
+}
+
+void pulse_start_callback(uint alarm_num)
+{
+    start_pending_pulse_trains();
+}
+
+// Starts a pulse train on every line in the output mask, replacing any train
+// running on those lines and returning them in stopped_mask. Finite trains
+// are repeated in bursts as specified by PulseTrainBurst. The train starts
+// immediately if the start time is zero, or otherwise at the specified system
+// time. Returns false if the timing is invalid.
+bool start_pulse_train(uint8_t output_mask, uint32_t width_us, uint32_t period_us,
+                       uint32_t count, uint64_t start_time_us, uint8_t& stopped_mask)
+{
+    pulse_timing_t timing;
+    uint32_t burst_count = count > 0 ? app_regs.pulse_train_burst[0] : 1;
+    uint32_t burst_period_us = burst_count != 1 ? app_regs.pulse_train_burst[1] : 0;
+    stopped_mask = 0;
+    if (output_mask == 0 || (burst_count != 1 && burst_period_us == 0) ||
+        !pulse_compute_timing(clock_get_hz(clk_sys), width_us, period_us, count, burst_period_us, timing))
+        return false;
+
+    // Trains take over their lines from PWM and from any sequence spanning them
+    if ((output_sequence.span_mask & output_mask) && stop_output_sequence())
+        report_output_sequence_state(0);
+    if (stop_pwm_outputs(output_mask))
+        pwm_enable_changed = true;
+
+    uint32_t status = save_and_disable_interrupts();
+    uint32_t train_id = ++pulse_train_id;
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        if ((output_mask & (1u << line)) == 0)
+            continue;
+        stopped_mask |= stop_pulse_channel(line);
+
+        // Infinite trains wrap back to the next pulse without counting
+        PIO pio = pulse_channel_pio(line);
+        uint sm = pulse_channel_sm(line);
+        uint offset = pulse_program_offset[line / NUM_PIO_STATE_MACHINES];
+        pio_sm_config config = pulse_train_program_get_default_config(offset);
+        sm_config_set_out_pins(&config, DO0_PIN + line, 1);
+        sm_config_set_clkdiv_int_frac(&config, timing.clkdiv, 0);
+        sm_config_set_fifo_join(&config, PIO_FIFO_JOIN_TX);
+        if (count == 0)
+            sm_config_set_wrap(&config, offset + pulse_train_offset_pulse, offset + pulse_train_offset_low);
+        pio_sm_init(pio, sm, offset, &config);
+        pio_interrupt_clear(pio, sm);
+
+        // Hand the line over to the PIO driven low, so it does not glitch
+        uint32_t pin_mask = 1u << (DO0_PIN + line);
+        pio_sm_set_pins_with_mask(pio, sm, 0, pin_mask);
+        pio_sm_set_pindirs_with_mask(pio, sm, pin_mask, pin_mask);
+        pio_gpio_init(pio, DO0_PIN + line);
+
+        pulse_channel_assign(pulse_channels[line], output_mask, train_id, period_us, count,
+                             burst_period_us, burst_count, timing, start_time_us);
+
+        // Load the first two bursts, so the second is ready when the first ends
+        pio_sm_put(pio, sm, timing.high_loops);
+        queue_pulse_burst(line);
+        if (burst_count != 1)
+            queue_pulse_burst(line);
+    }
+
+    if (start_time_us == 0)
+    {
+        enable_pulse_train(train_id);
+        start_time_us = time_us_64();
+        for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+        {
+            if (output_mask & (1u << line))
+                pulse_channels[line].start_time_us = start_time_us;
+        }
+    }
+    else start_pending_pulse_trains();
+
+    // Keep a record of the train if it is reported, counting trains left
+    // unreported because every record is pending
+    pulse_report_mode_t report_mode = (pulse_report_mode_t)app_regs.pulse_train_report_mode;
+    uint32_t record = report_mode != PULSE_REPORT_NONE ? pulse_report_find_free(pulse_reports) : 0;
+    if (report_mode != PULSE_REPORT_NONE && record == PULSE_REPORT_CAPACITY)
+        app_regs.pulse_train_report_overrun++;
+    else if (report_mode != PULSE_REPORT_NONE)
+    {
+        pulse_report_t& report = pulse_reports[record];
+        report.train_mask = output_mask;
+        report.train_id = train_id;
+        report.mode = report_mode;
+        report.interval = app_regs.pulse_train_report_interval;
+        report.pulse_period_us = period_us;
+        report.pulse_count = count;
+        report.burst_period_us = burst_period_us;
+        report.burst_count = burst_count;
+        report.start_time_us = start_time_us;
+        report.stop_time_us = 0;
+        report.stop_count = 0;
+        report.next_index = 0;
+        report.stopped = false;
+        report.active = true;
+    }
+    restore_interrupts(status);
+    return true;
+}
+
+void pulse_train_irq_callback()
+{
+    // Load the next burst of every train which has completed a burst, and
+    // release the lines of trains and of the sequence once they are played
+    uint8_t stopped_mask = 0;
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        PIO pio = pulse_channel_pio(line);
+        uint sm = pulse_channel_sm(line);
+        if (pio_interrupt_get(pio, sm))
+        {
+            pio_interrupt_clear(pio, sm);
+            if (output_sequence.active && line == output_sequence.line)
+            {
+                stop_output_sequence();
+                report_output_sequence_state(0);
+            }
+            else stopped_mask |= end_pulse_burst(line);
+        }
+    }
+
+    report_stopped_pulse_trains(stopped_mask);
+}
+
+void write_start_pulse_train(msg_t& msg)
+{
+    uint32_t pulse_train_config[4];
+    for (uint32_t i = 0; i < 4; i++)
+        pulse_train_config[i] = app_regs.start_pulse_train[i];
+    HarpCore::copy_msg_payload_to_register(msg);
+
+    // Restart the train, reporting any train it replaces. A pending start
+    // time applies to this train only, and must not be in the past.
+    uint8_t stopped_mask = 0;
+    uint8_t output_mask = (uint8_t)((app_regs.start_pulse_train[0] & 0xFF));
+    uint64_t start_time_us = 0;
+    if (app_regs.pulse_train_start_time > 0)
+        start_time_us = HarpCore::harp_to_system_us_64(app_regs.pulse_train_start_time);
+    app_regs.pulse_train_start_time = 0;
+    bool started = (start_time_us == 0 || start_time_us > time_us_64()) &&
+                   start_pulse_train(output_mask,
+                                     app_regs.start_pulse_train[1],
+                                     app_regs.start_pulse_train[2],
+                                     app_regs.start_pulse_train[3],
+                                     start_time_us,
+                                     stopped_mask);
+    report_stopped_pulse_trains(stopped_mask);
+
+    if (!started)
+    {
+        for (uint32_t i = 0; i < 4; i++)
+            app_regs.start_pulse_train[i] = pulse_train_config[i];
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_stop_pulse_train(msg_t& msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+
+    stop_pulse_trains(app_regs.stop_pulse_train);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_pulse_train_report(msg_t& msg)
+{
+    uint8_t report_mode = app_regs.pulse_train_report_mode;
+    uint16_t report_interval = app_regs.pulse_train_report_interval;
+    HarpCore::copy_msg_payload_to_register(msg);
+
+    // The policy applies to trains started from now on
+    if (app_regs.pulse_train_report_mode >= PULSE_REPORT_MODE_COUNT ||
+        app_regs.pulse_train_report_interval == 0)
+    {
+        app_regs.pulse_train_report_mode = report_mode;
+        app_regs.pulse_train_report_interval = report_interval;
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_start_output_sequence(msg_t& msg)
+{
+    uint8_t sequence_config[2];
+    for (uint32_t i = 0; i < 2; i++)
+        sequence_config[i] = app_regs.start_output_sequence[i];
+    HarpCore::copy_msg_payload_to_register(msg);
+
+    // Restart the sequence, reporting any train on the lines it spans
+    uint8_t stopped_mask = 0;
+    bool started = start_output_sequence(app_regs.start_output_sequence[0],
+                                         app_regs.start_output_sequence[1],
+                                         stopped_mask);
+    report_stopped_pulse_trains(stopped_mask);
+
+    if (!started)
+    {
+        for (uint32_t i = 0; i < 2; i++)
+            app_regs.start_output_sequence[i] = sequence_config[i];
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+    report_output_sequence_state(app_regs.start_output_sequence[0]);
+}
+
+void write_stop_output_sequence(msg_t& msg)
+{
+    HarpCore::copy_msg_payload_to_register(msg);
+
+    if (stop_output_sequence())
+        report_output_sequence_state(0);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+// Drives the lines in PWM mode from the frequency and duty cycle registers,
+// taking over lines entering PWM mode from trains and sequences and returning
+// the trains stopped in stopped_mask. Returns false without changing the
+// outputs if any frequency or duty cycle is out of range, or lines sharing a
+// slice specify different frequencies.
+bool update_pwm_outputs(uint8_t previous_mask, uint8_t& stopped_mask)
+{
+    pwm_timing_t timing[DO_LINE_COUNT];
+    uint8_t enable_mask = app_regs.pwm_enable;
+    stopped_mask = 0;
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        if ((enable_mask & (1u << line)) == 0)
+            continue;
+        if (app_regs.pwm_duty_cycle[line] > PWM_DUTY_FULL_SCALE ||
+            !pwm_compute_timing(clock_get_hz(clk_sys), app_regs.pwm_frequency[line], timing[line]))
+            return false;
+
+        uint8_t shared_mask = pwm_slice_lines(pwm_gpio_to_slice_num(DO0_PIN + line)) & enable_mask;
+        for (uint32_t other = 0; other < DO_LINE_COUNT; other++)
+        {
+            if ((shared_mask & (1u << other)) && app_regs.pwm_frequency[other] != app_regs.pwm_frequency[line])
+                return false;
+        }
+    }
+
+    uint8_t started_mask = enable_mask & ~previous_mask;
+    stopped_mask = stop_pulse_trains(started_mask);
+    if ((output_sequence.output_mask & started_mask) && stop_output_sequence())
+        report_output_sequence_state(0);
+
+    // Counters restart only on slices which were not running, so updates to
+    // running slices are latched at the end of their current period
+    uint32_t status = save_and_disable_interrupts();
+    release_pwm_lines(previous_mask & ~enable_mask);
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        if ((enable_mask & (1u << line)) == 0)
+            continue;
+        uint pin = DO0_PIN + line;
+        uint slice = pwm_gpio_to_slice_num(pin);
+        pwm_set_clkdiv_int_frac(slice, timing[line].clkdiv_16 >> 4, timing[line].clkdiv_16 & 0xF);
+        pwm_set_wrap(slice, timing[line].wrap);
+        pwm_set_chan_level(slice, pwm_gpio_to_channel(pin), pwm_duty_level(timing[line], app_regs.pwm_duty_cycle[line]));
+        if ((pwm_slice_lines(slice) & previous_mask) == 0)
+        {
+            pwm_set_counter(slice, 0);
+            pwm_set_enabled(slice, true);
+        }
+        if (started_mask & (1u << line))
+            gpio_set_function(pin, GPIO_FUNC_PWM);
+    }
+    restore_interrupts(status);
+    return true;
+}
+
+void write_pwm(msg_t& msg)
+{
+    uint8_t pwm_enable = app_regs.pwm_enable;
+    uint32_t pwm_frequency[DO_LINE_COUNT];
+    uint16_t pwm_duty_cycle[DO_LINE_COUNT];
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        pwm_frequency[line] = app_regs.pwm_frequency[line];
+        pwm_duty_cycle[line] = app_regs.pwm_duty_cycle[line];
+    }
+    HarpCore::copy_msg_payload_to_register(msg);
+
+    uint8_t stopped_mask = 0;
+    if (!update_pwm_outputs(pwm_enable, stopped_mask))
+    {
+        app_regs.pwm_enable = pwm_enable;
+        for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+        {
+            app_regs.pwm_frequency[line] = pwm_frequency[line];
+            app_regs.pwm_duty_cycle[line] = pwm_duty_cycle[line];
+        }
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+
+    report_stopped_pulse_trains(stopped_mask);
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+uint64_t adc_conversion_time_us(uint64_t conversion)
+{
+    uint64_t system_time_us = adc_start_time_us + adc_conversions_to_us(conversion, adc_timing);
+    return HarpCore::system_to_harp_us_64(system_time_us);
+}
+
+uint32_t analog_field_index(uint32_t input)
+{
+    // Analog registers hold AI0-AI2 followed by the temperature sensor
+    return input == ADC_TEMPERATURE_INPUT ? AI_TEMPERATURE_INDEX : input;
+}
+
+// Applies the reflex action of a channel to the digital outputs and returns
+// the index of the output register to report, or zero if none.
+uint8_t run_analog_reflex(uint32_t slot, bool above)
+{
+    uint8_t output_mask = adc_reflex_output[slot];
+    switch (adc_reflex_action[slot])
+    {
+        case REFLEX_SET:
+            if (!above) return 0;
+            gpio_set_mask(output_mask << DO0_PIN);
+            return 1;
+        case REFLEX_CLEAR:
+            if (!above) return 0;
+            gpio_clr_mask(output_mask << DO0_PIN);
+            return 2;
+        case REFLEX_TOGGLE:
+            if (!above) return 0;
+            gpio_xor_mask(output_mask << DO0_PIN);
+            return 3;
+        case REFLEX_FOLLOW:
+            gpio_put_masked(output_mask << DO0_PIN, above ? output_mask << DO0_PIN : 0);
+            return above ? 1 : 2;
+        case REFLEX_PULSE_TRAIN:
+        {
+            if (!above) return 0;
+            uint8_t stopped_mask;
+            bool started = start_pulse_train(output_mask,
+                                             app_regs.analog_reflex_pulse_train[0],
+                                             app_regs.analog_reflex_pulse_train[1],
+                                             app_regs.analog_reflex_pulse_train[2],
+                                             0,
+                                             stopped_mask);
+            report_stopped_pulse_trains(stopped_mask);
+            return started ? 1 : 0;
+        }
+        default:
+            return 0;
+    }
+}
+
+void handle_threshold_crossing(uint32_t slot, uint64_t conversion)
+{
+    // Act on the outputs first to minimize reflex latency
+    bool above = adc_detectors[slot].above;
+    uint8_t reflex_reg_index = run_analog_reflex(slot, above);
+    uint64_t timestamp = adc_conversion_time_us(conversion);
+    if (reflex_reg_index > 0)
+        queue_adc_event(reflex_reg_index, adc_reflex_output[slot], timestamp);
+
+    if (adc_threshold_slots & (1u << slot))
+    {
+        adc_threshold_state ^= 1u << adc_layout.inputs[slot];
+        queue_adc_event(18, adc_threshold_state, timestamp);
+        if (above && capture_state == CAPTURE_ARMED &&
+            app_regs.analog_capture_trigger == CAPTURE_TRIGGER_ANALOG_THRESHOLD)
+            trigger_capture(conversion);
+    }
+}
+
+void copy_capture_window()
+{
+    // The window may wrap around the end of the ring
+    uint32_t start = capture_start & (adc_ring_length - 1);
+    uint32_t head = adc_ring_length - start < capture_length ? adc_ring_length - start : capture_length;
+    memcpy(capture_buffer, &adc_ring[start], head * sizeof(uint16_t));
+    memcpy(&capture_buffer[head], adc_ring, (capture_length - head) * sizeof(uint16_t));
+    capture_sent = 0;
+    capture_state = CAPTURE_READY;
+}
+
+// Returns the first pulse of a train whose sample time is at or after the
+// specified conversion, limited to the pulse count of finite trains.
+uint32_t pulse_sample_first_index(const pulse_channel_t& pulse, uint64_t conversion)
+{
+    uint64_t time_us = adc_start_time_us + adc_conversions_to_us(conversion, adc_timing);
+    uint64_t first_sample_us = pulse.start_time_us + app_regs.analog_pulse_sample_delay;
+    if (time_us <= first_sample_us)
+        return 0;
+    uint64_t index = pulse_edges_elapsed(time_us - first_sample_us - 1, pulse.pulse_period_us,
+                                         pulse.pulse_count, pulse.burst_period_us);
+    uint64_t total_count = pulse_total_count(pulse.pulse_count, pulse.burst_count);
+    if (total_count > 0 && index > total_count)
+        index = total_count;
+    return index < UINT32_MAX ? (uint32_t)index : UINT32_MAX;
+}
+
+void process_pulse_samples()
+{
+    // Scans older than one block short of the ring may already be overwritten
+    uint32_t channel_count = adc_layout.channel_count;
+    uint64_t ring_span = adc_ring_length - adc_block_capacity;
+    uint64_t oldest_conversion = adc_conversion_count > ring_span ? adc_conversion_count - ring_span + channel_count : 0;
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        pulse_channel_t& pulse = pulse_channels[line];
+        if (!pulse.active)
+            continue;
+
+        // Trains which are not selected follow the conversions, so selecting
+        // a running train samples its next pulse instead of replaying the past
+        if (!(pulse.train_mask & app_regs.analog_pulse_sample_outputs))
+        {
+            uint32_t next_index = pulse_sample_first_index(pulse, adc_conversion_count);
+            if (next_index > pulse.sample_index)
+                pulse.sample_index = next_index;
+            continue;
+        }
+
+        // Report each train once, from the lowest of its lines still running
+        bool reported = false;
+        for (uint32_t i = 0; i < line; i++)
+            reported |= pulse_channels[i].active && pulse_channels[i].train_id == pulse.train_id;
+        if (reported)
+            continue;
+
+        // Pulses whose scans have left the ring are dropped without a lookup
+        uint32_t first_index = pulse_sample_first_index(pulse, oldest_conversion);
+        if (first_index > pulse.sample_index)
+        {
+            app_regs.analog_pulse_sample_overrun += first_index - pulse.sample_index;
+            pulse.sample_index = first_index;
+        }
+
+        uint64_t total_count = pulse_total_count(pulse.pulse_count, pulse.burst_count);
+        for (uint32_t n = 0; n < pulse_sample_block_limit && (total_count == 0 || pulse.sample_index < total_count); n++)
+        {
+            // Select the first scan starting at or after the sample delay
+            uint64_t sample_time_us = pulse.start_time_us + app_regs.analog_pulse_sample_delay +
+                                      pulse_edge_offset_us(pulse.sample_index, pulse.pulse_period_us,
+                                                           pulse.pulse_count, pulse.burst_period_us);
+            uint64_t conversion = sample_time_us > adc_start_time_us
+                ? adc_us_to_conversions(sample_time_us - adc_start_time_us, adc_timing)
+                : 0;
+            conversion = (conversion + channel_count - 1) / channel_count * channel_count;
+            if (adc_conversion_count < conversion + channel_count)
+                break;
+
+            // Drop scans which may already be overwritten by the DMA
+            uint32_t pulse_index = pulse.sample_index++;
+            if (adc_conversion_count - conversion > ring_span)
+            {
+                app_regs.analog_pulse_sample_overrun++;
+                continue;
+            }
+
+            pulse_sample_item_t item;
+            item.timestamp = adc_conversion_time_us(conversion);
+            item.pulse_index = pulse_index;
+            item.output_mask = pulse.train_mask;
+            for (uint32_t channel = 0; channel < channel_count; channel++)
+            {
+                uint16_t sample = adc_ring[(conversion + channel) & (adc_ring_length - 1)] & 0xFFF;
+                item.analog_data[channel] = calibration_apply(adc_calibration[channel], sample);
+            }
+            if (!spsc_queue_try_add(pulse_sample_queue, item))
+                app_regs.analog_pulse_sample_overrun++;
+        }
+
+        // Keep the other lines in step in case this line is stopped first
+        for (uint32_t i = line + 1; i < DO_LINE_COUNT; i++)
+        {
+            if (pulse_channels[i].train_id == pulse.train_id)
+                pulse_channels[i].sample_index = pulse.sample_index;
+        }
+    }
+}
+
+void adc_dma_callback()
+{
+    if (!dma_channel_get_irq0_status(adc_sample_channel))
+        return;
+
+    // The write address is read before acknowledging the interrupt, so a block
+    // completing in between raises it again rather than going unnoticed.
+    uint32_t write_index = (uint32_t)((uintptr_t)dma_hw->ch[adc_sample_channel].write_addr - (uintptr_t)adc_ring) / sizeof(uint16_t);
+    dma_channel_acknowledge_irq0(adc_sample_channel);
+
+    // Conversions are only lost between the round robin and the ring when the
+    // FIFO overflows, after which the scan position of every sample is unknown.
+    // Discard the block and restart the scan from the first enabled channel.
+    if (adc_hw->fcs & ADC_FCS_OVER_BITS)
+    {
+        resync_adc();
+        return;
+    }
+
+    // The sample channel has already been retriggered further along the ring,
+    // so the completed block can be consumed while the next one is filled.
+    // Only the first block after starting may differ from the block length.
+    // Progress follows the write address of the sample channel rather than
+    // the interrupt count, so blocks completed before a late interrupt was
+    // serviced are consumed together, and an interrupt raised for a block
+    // that was already consumed finds less than a block and has nothing to do.
+    // A write address so far ahead that unread samples may be overwritten
+    // means the ring no longer matches the conversion count, so restart.
+    uint32_t available = (write_index - adc_ring_index) & (adc_ring_length - 1);
+    uint32_t block_length = adc_pending_block_length;
+    if (available < block_length)
+        return;
+    if (available > adc_ring_length - adc_block_capacity)
+    {
+        resync_adc();
+        return;
+    }
+    while (available - block_length >= adc_block_length)
+        block_length += adc_block_length;
+    adc_pending_block_length = adc_block_length;
+    for (uint32_t i = 0; i < block_length; i++)
+    {
+        // Mask the values to 12 bits (0xFFF) to ensure only valid ADC bits are used
+        int32_t sample = adc_ring[adc_ring_index] & 0xFFF;
+        if (adc_biquad_slots & (1u << adc_channel_index))
+            sample = biquad_process(adc_biquads[adc_channel_index], sample);
+        uint16_t value = calibration_apply(adc_calibration[adc_channel_index], sample);
+        adc_ring_index = (adc_ring_index + 1) & (adc_ring_length - 1);
+        uint64_t conversion = adc_conversion_count++;
+
+        if ((adc_detector_slots & (1u << adc_channel_index)) &&
+            threshold_update(adc_detectors[adc_channel_index], value))
+            handle_threshold_crossing(adc_channel_index, conversion);
+
+        // Rectified values are smoothed by the decimation filter, while squares
+        // are summed separately since they exceed the filter input range.
+        uint16_t filter_value = value;
+        if (adc_rectified_slots & (1u << adc_channel_index))
+            filter_value = envelope_rectify(adc_envelopes[adc_channel_index], value);
+        else if (adc_rms_slots & (1u << adc_channel_index))
+            envelope_accumulate(adc_envelopes[adc_channel_index], value);
+        cic_integrate(adc_filters[adc_channel_index], adc_filter_order, filter_value);
+        if (adc_statistics_enabled)
+            statistics_update(adc_statistics[adc_channel_index], value);
+        if (++adc_channel_index < adc_layout.channel_count)
+            continue;
+
+        adc_channel_index = 0;
+        if (++adc_scan_count < adc_timing.oversampling)
+            continue;
+
+        // Timestamp the frame at the first conversion of its window
+        adc_queue_item_t item;
+        item.timestamp = adc_conversion_time_us(adc_frame_start);
+        adc_frame_start = adc_conversion_count;
+        for (uint32_t channel = 0; channel < adc_layout.channel_count; channel++)
+        {
+            item.analog_data[channel] = cic_decimate(adc_filters[channel], adc_filter_order, adc_filter_gain);
+            if (adc_rms_slots & (1u << channel))
+                item.analog_data[channel] = envelope_rms(adc_envelopes[channel], adc_timing.oversampling);
+        }
+        adc_scan_count = 0;
+
+        // Replace the frame values with their envelope over the frame window
+        item.has_statistics = adc_statistics_enabled;
+        if (adc_statistics_enabled)
+        {
+            uint16_t* statistics = item.statistics;
+            for (uint32_t channel = 0; channel < adc_layout.channel_count; channel++)
+            {
+                sample_statistics_t& channel_statistics = adc_statistics[channel];
+                *statistics++ = channel_statistics.minimum;
+                *statistics++ = channel_statistics.maximum;
+                *statistics++ = statistics_mean(channel_statistics, adc_timing.oversampling);
+                statistics_reset(channel_statistics);
+            }
+        }
+        adc_statistics_enabled = app_regs.analog_statistics_enable;
+
+        // Skip frames until the filter window is filled with conversions
+        if (adc_settle_frames > 0)
+        {
+            adc_settle_frames--;
+            continue;
+        }
+        item.sequence = adc_frame_sequence++;
+        if (adc_first_frame_pending)
+        {
+            adc_first_frame_pending = false;
+            app_regs.analog_start_latency = (uint32_t)(time_us_64() - adc_enable_time_us);
+            adc_start_latency_timestamp = item.timestamp;
+            adc_start_latency_ready = true;
+        }
+        if (app_regs.analog_data_enable && !spsc_queue_try_add(adc_queue, item))
+            app_regs.analog_overrun++;
+    }
+
+    process_pulse_samples();
+
+    // Freeze the capture window once all post-trigger conversions are in the ring
+    if (capture_state == CAPTURE_TRIGGERED && adc_conversion_count >= capture_start + capture_length)
+        copy_capture_window();
+}
+
+bool validate_capture_window(uint32_t channel_count)
+{
+    uint32_t scan_count = app_regs.analog_capture_window[0] + app_regs.analog_capture_window[1];
+    return scan_count > 0 && scan_count * channel_count <= capture_capacity;
+}
+
+// Returns true if the conversion rate leaves time to run the biquad sections
+// of the channels in the layout.
+bool validate_biquad_rate(const adc_frame_layout_t& layout, const adc_timing_t& timing)
+{
+    if (adc_conversion_rate(timing) <= adc_biquad_max_conversion_rate)
+        return true;
+    for (uint32_t slot = 0; slot < layout.channel_count; slot++)
+    {
+        if (app_regs.analog_biquad_sections[analog_field_index(layout.inputs[slot])] > 0)
+            return false;
+    }
+    return true;
+}
+
+bool validate_adc_config()
 {
-    struct repeating_timer timer;
-    uint8_t output_mask;
-    uint32_t pulse_width_us;
-    uint32_t pulse_period_us;
-    uint32_t pulse_count;
-};
-pulse_train_t pulse_train_timers[pulse_train_count];
-
-// Repeating timer and buffers for ADC sampling using 
-// Pointer to an address is required for the reinitialization DMA channel.
-uint16_t adc_vals[3] = {0, 0, 0};
-uint16_t* data_ptr[1] = {adc_vals};
-struct repeating_timer adc_timer;
-const int32_t adc_period_us = 4000;
-const int32_t adc_callback_delay_us = 80000;
-int adc_sample_channel;
-int adc_ctrl_channel;
-static queue_t adc_queue;
+    adc_frame_layout_t layout;
+    adc_timing_t timing;
+    uint64_t gain;
+    return adc_compute_frame_layout(app_regs.analog_channel_enable, layout) &&
+           app_regs.analog_decimation <= adc_max_decimation &&
+           app_regs.analog_data_batch_size * layout.channel_count <= analog_batch_capacity &&
+           validate_capture_window(layout.channel_count) &&
+           adc_compute_timing(app_regs.analog_sample_rate, layout.channel_count, app_regs.analog_decimation, timing) &&
+           validate_biquad_rate(layout, timing) &&
+           cic_compute_gain(timing.oversampling, app_regs.analog_filter_order, gain);
+}
 
-// Define queue item contents
-#pragma pack(push, 1)
-struct adc_queue_item_t
+void update_threshold_config()
 {
-    uint64_t timestamp;
-    uint16_t analog_data[3];
-};
-#pragma pack(pop)
-adc_queue_item_t adc_queue_current;
+    // Map per-channel levels and reflexes onto scan positions. The reported
+    // state keeps only channels which are still enabled for crossing events.
+    uint32_t status = save_and_disable_interrupts();
+    adc_detector_slots = 0;
+    adc_threshold_slots = 0;
+    adc_reflex_slots = 0;
+    adc_threshold_state = 0;
+    for (uint32_t slot = 0; slot < adc_layout.channel_count; slot++)
+    {
+        uint32_t input = adc_layout.inputs[slot];
+        uint32_t index = analog_field_index(input);
+        threshold_detector_t& detector = adc_detectors[slot];
+        threshold_configure(detector, app_regs.analog_threshold[index], app_regs.analog_hysteresis[index]);
+        adc_reflex_action[slot] = app_regs.analog_reflex_action[index];
+        adc_reflex_output[slot] = app_regs.analog_reflex_output[index];
+        if (adc_reflex_action[slot] != REFLEX_NONE)
+        {
+            adc_detector_slots |= 1u << slot;
+            adc_reflex_slots |= 1u << slot;
+        }
+        if (app_regs.analog_threshold_enable & (1u << input))
+        {
+            adc_detector_slots |= 1u << slot;
+            adc_threshold_slots |= 1u << slot;
+            if (detector.above)
+                adc_threshold_state |= 1u << input;
+        }
+        if ((adc_detector_slots & (1u << slot)) == 0)
+            threshold_reset(detector);
+    }
+    restore_interrupts(status);
+}
 
-// Harp App Register Setup.
-const size_t reg_count = 8;
+void update_calibration_config()
+{
+    // Map per-channel calibration onto scan positions
+    uint32_t status = save_and_disable_interrupts();
+    for (uint32_t slot = 0; slot < adc_layout.channel_count; slot++)
+    {
+        uint32_t index = analog_field_index(adc_layout.inputs[slot]);
+        adc_calibration[slot].offset = app_regs.analog_calibration_offset[index];
+        adc_calibration[slot].gain = app_regs.analog_calibration_gain[index];
+    }
+    restore_interrupts(status);
+}
 
-// Define register contents.
-#pragma pack(push, 1)
-struct app_regs_t
+void update_biquad_config()
 {
-    volatile uint8_t di_state;
-    volatile uint8_t do_set;
-    volatile uint8_t do_clear;
-    volatile uint8_t do_toggle;
-    volatile uint8_t do_state;
-    volatile uint32_t start_pulse_train[4];
-    volatile uint8_t stop_pulse_train;
-    volatile uint16_t analog_data[3];
-} app_regs;
-#pragma pack(pop)
+    // Map per-channel coefficients onto scan positions and restart the filters
+    uint32_t status = save_and_disable_interrupts();
+    adc_biquad_slots = 0;
+    for (uint32_t slot = 0; slot < adc_layout.channel_count; slot++)
+    {
+        uint32_t index = analog_field_index(adc_layout.inputs[slot]);
+        biquad_cascade_t& cascade = adc_biquads[slot];
+        const volatile int32_t* coefficients = &app_regs.analog_biquad_coefficients[index * BIQUAD_MAX_SECTIONS * BIQUAD_COEFFICIENT_COUNT];
+        for (uint32_t section = 0; section < BIQUAD_MAX_SECTIONS; section++)
+        {
+            biquad_coefficients_t& c = cascade.coefficients[section];
+            c.b0 = *coefficients++;
+            c.b1 = *coefficients++;
+            c.b2 = *coefficients++;
+            c.a1 = *coefficients++;
+            c.a2 = *coefficients++;
+        }
+        cascade.section_count = app_regs.analog_biquad_sections[index];
+        biquad_reset(cascade);
+        if (cascade.section_count > 0)
+            adc_biquad_slots |= 1u << slot;
+    }
+    restore_interrupts(status);
+}
 
-// Define register "specs."
-RegSpecs app_reg_specs[reg_count]
+void update_envelope_config()
 {
-    {(uint8_t*)&app_regs.di_state, sizeof(app_regs.di_state), U8},
-    {(uint8_t*)&app_regs.do_set, sizeof(app_regs.do_set), U8},
-    {(uint8_t*)&app_regs.do_clear, sizeof(app_regs.do_clear), U8},
-    {(uint8_t*)&app_regs.do_toggle, sizeof(app_regs.do_toggle), U8},
-    {(uint8_t*)&app_regs.do_state, sizeof(app_regs.do_state), U8},
-    {(uint8_t*)&app_regs.start_pulse_train, sizeof(app_regs.start_pulse_train), U32},
-    {(uint8_t*)&app_regs.stop_pulse_train, sizeof(app_regs.stop_pulse_train), U8},
-    {(uint8_t*)&app_regs.analog_data, sizeof(app_regs.analog_data), U16}
-};
+    // Map per-channel envelope modes onto scan positions and restart the detectors
+    uint32_t status = save_and_disable_interrupts();
+    adc_rectified_slots = 0;
+    adc_rms_slots = 0;
+    for (uint32_t slot = 0; slot < adc_layout.channel_count; slot++)
+    {
+        uint32_t index = analog_field_index(adc_layout.inputs[slot]);
+        if (app_regs.analog_envelope_mode[index] == ENVELOPE_RECTIFIED)
+            adc_rectified_slots |= 1u << slot;
+        else if (app_regs.analog_envelope_mode[index] == ENVELOPE_RMS)
+            adc_rms_slots |= 1u << slot;
+        envelope_reset(adc_envelopes[slot]);
+    }
+    restore_interrupts(status);
+}
 
-void gpio_callback(uint gpio, uint32_t events)
+void clear_calibration()
 {
-    uint32_t gpio_state = gpio_get_all();
-    app_regs.di_state = 0;
-    app_regs.di_state |= (gpio_state & 0xC) >> 2;
-    app_regs.di_state |= (gpio_state & 0x7000) >> 10;
-    HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS);
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+    {
+        app_regs.analog_calibration_offset[i] = 0;
+        app_regs.analog_calibration_gain[i] = CALIBRATION_UNITY_GAIN;
+    }
 }
 
-void write_do_set(msg_t &msg)
+bool load_calibration()
+{
+    // Flash is memory-mapped through XIP, so the record can be read in place
+    const calibration_record_t* record = (const calibration_record_t*)(XIP_BASE + calibration_flash_offset);
+    if (record->magic != calibration_magic ||
+        record->checksum != calibration_checksum(record->channels, AI_CHANNEL_COUNT))
+        return false;
+
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+    {
+        if (!calibration_valid(record->channels[i]))
+            return false;
+    }
+
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+    {
+        app_regs.analog_calibration_offset[i] = record->channels[i].offset;
+        app_regs.analog_calibration_gain[i] = record->channels[i].gain;
+    }
+    return true;
+}
+
+void store_calibration()
+{
+    uint8_t page[FLASH_PAGE_SIZE];
+    memset(page, 0xFF, sizeof(page));
+    calibration_record_t* record = (calibration_record_t*)page;
+    record->magic = calibration_magic;
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+    {
+        record->channels[i].offset = app_regs.analog_calibration_offset[i];
+        record->channels[i].gain = app_regs.analog_calibration_gain[i];
+    }
+    record->checksum = calibration_checksum(record->channels, AI_CHANNEL_COUNT);
+
+    // Code cannot run from flash while it is being written, and the DMA ring
+    // would overflow while interrupts are disabled, so stop acquisition.
+    if (events_active)
+        disable_adc_events();
+    uint32_t status = save_and_disable_interrupts();
+    flash_range_erase(calibration_flash_offset, FLASH_SECTOR_SIZE);
+    flash_range_program(calibration_flash_offset, page, FLASH_PAGE_SIZE);
+    restore_interrupts(status);
+    if (events_active)
+        enable_adc_events();
+}
+
+void update_adc_config()
+{
+    // Rebuild the scan order and resize the batch register so events
+    // carry exactly the configured frames of all enabled channels
+    adc_compute_frame_layout(app_regs.analog_channel_enable, adc_layout);
+    memset((void*)app_regs.analog_data, 0, sizeof(app_regs.analog_data));
+    uint32_t field_count = (adc_layout.round_robin_mask & (1u << ADC_TEMPERATURE_INPUT)) ? AI_CHANNEL_COUNT : AI_TEMPERATURE_INDEX;
+    app_reg_specs[7].num_bytes = field_count * sizeof(uint16_t);
+    uint32_t frame_count = app_regs.analog_data_batch_size > 0 ? app_regs.analog_data_batch_size : 1;
+    app_reg_specs[10].num_bytes = frame_count * adc_layout.channel_count * sizeof(uint16_t);
+    app_reg_specs[30].num_bytes = analog_statistics_count * adc_layout.channel_count * sizeof(uint16_t);
+    analog_batch_frames = 0;
+    update_threshold_config();
+    update_calibration_config();
+    update_biquad_config();
+    update_envelope_config();
+}
+
+void write_analog_config(msg_t& msg)
 {
+    // Keep the previous acquisition settings in case the new ones are invalid
+    uint32_t sample_rate = app_regs.analog_sample_rate;
+    uint8_t batch_size = app_regs.analog_data_batch_size;
+    uint16_t decimation = app_regs.analog_decimation;
+    uint8_t filter_order = app_regs.analog_filter_order;
+    uint8_t channel_enable = app_regs.analog_channel_enable;
     HarpCore::copy_msg_payload_to_register(msg);
-    gpio_set_mask(app_regs.do_set << DO0_PIN);
+
+    if (!validate_adc_config())
+    {
+        app_regs.analog_sample_rate = sample_rate;
+        app_regs.analog_data_batch_size = batch_size;
+        app_regs.analog_decimation = decimation;
+        app_regs.analog_filter_order = filter_order;
+        app_regs.analog_channel_enable = channel_enable;
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+
+    // Restart acquisition so the new ADC settings take effect immediately
+    if (events_active)
+        disable_adc_events();
+    update_adc_config();
+    if (events_active)
+        enable_adc_events();
     HarpCore::send_harp_reply(WRITE, msg.header.address);
 }
 
-void write_do_clear(msg_t &msg)
+void write_analog_threshold(msg_t& msg)
 {
+    uint8_t threshold_enable = app_regs.analog_threshold_enable;
     HarpCore::copy_msg_payload_to_register(msg);
-    gpio_clr_mask(app_regs.do_clear << DO0_PIN);
+    if (app_regs.analog_threshold_enable & ~ADC_CHANNEL_MASK)
+    {
+        app_regs.analog_threshold_enable = threshold_enable;
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+
+    // Levels are applied immediately without restarting acquisition
+    update_threshold_config();
     HarpCore::send_harp_reply(WRITE, msg.header.address);
 }
 
-void write_do_toggle(msg_t &msg)
+void write_analog_data_enable(msg_t& msg)
 {
+    uint8_t data_enable = app_regs.analog_data_enable;
     HarpCore::copy_msg_payload_to_register(msg);
-    gpio_xor_mask(app_regs.do_toggle << DO0_PIN);
+    if (app_regs.analog_data_enable > 1)
+    {
+        app_regs.analog_data_enable = data_enable;
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+
+    analog_batch_frames = 0;
     HarpCore::send_harp_reply(WRITE, msg.header.address);
 }
 
-void write_do_state(msg_t &msg)
+void write_analog_reflex(msg_t& msg)
 {
+    uint8_t reflex_action[AI_CHANNEL_COUNT];
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+        reflex_action[i] = app_regs.analog_reflex_action[i];
     HarpCore::copy_msg_payload_to_register(msg);
-    gpio_put_masked(DO_MASK, app_regs.do_state << DO0_PIN);
+
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+    {
+        if (app_regs.analog_reflex_action[i] >= REFLEX_ACTION_COUNT)
+        {
+            for (uint32_t j = 0; j < AI_CHANNEL_COUNT; j++)
+                app_regs.analog_reflex_action[j] = reflex_action[j];
+            HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+            return;
+        }
+    }
+
+    // Restart acquisition since active reflexes shorten the DMA block period
+    if (events_active)
+        disable_adc_events();
+    update_threshold_config();
+    if (events_active)
+        enable_adc_events();
     HarpCore::send_harp_reply(WRITE, msg.header.address);
 }
 
-int64_t pulse_callback(alarm_id_t id, void *user_data)
+void reset_capture()
+{
+    // Discard any pending capture and re-arm if a trigger is configured
+    uint32_t status = save_and_disable_interrupts();
+    capture_state = app_regs.analog_capture_trigger != CAPTURE_TRIGGER_NONE ? CAPTURE_ARMED : CAPTURE_IDLE;
+    restore_interrupts(status);
+}
+
+void write_analog_capture(msg_t& msg)
 {
-    pulse_train_t *pulse_train = (pulse_train_t *)user_data;
-    app_regs.do_clear = pulse_train->output_mask;
-    gpio_clr_mask(pulse_train->output_mask << DO0_PIN);
+    uint8_t capture_trigger = app_regs.analog_capture_trigger;
+    uint16_t pre_trigger = app_regs.analog_capture_window[0];
+    uint16_t post_trigger = app_regs.analog_capture_window[1];
+    HarpCore::copy_msg_payload_to_register(msg);
 
-    // Emit stop notifications for pulse and pulse train
-    uint64_t harp_time_us = HarpCore::harp_time_us_64();
-    HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 2, harp_time_us);
-    if (pulse_train->timer.delay_us == 0)
+    if (app_regs.analog_capture_trigger >= CAPTURE_TRIGGER_COUNT ||
+        !validate_capture_window(adc_layout.channel_count))
     {
-        // Mark timer as cancelled if pulse train stops
-        pulse_train->timer.alarm_id = 0;
-        app_regs.stop_pulse_train = pulse_train->output_mask;
-        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 6, harp_time_us);
+        app_regs.analog_capture_trigger = capture_trigger;
+        app_regs.analog_capture_window[0] = pre_trigger;
+        app_regs.analog_capture_window[1] = post_trigger;
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
     }
-    return 0;
+
+    reset_capture();
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
 }
 
-bool pulse_train_callback(repeating_timer_t *rt)
+void write_analog_start_delay(msg_t& msg)
 {
-    pulse_train_t *pulse_train = (pulse_train_t *)rt->user_data;
+    uint32_t start_delay = app_regs.analog_start_delay;
+    HarpCore::copy_msg_payload_to_register(msg);
+    if (app_regs.analog_start_delay > adc_max_start_delay_us)
+    {
+        app_regs.analog_start_delay = start_delay;
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
 
-    // Configure the repeating timer delay following the first pulse
-    pulse_train->timer.delay_us = -((int64_t)pulse_train->pulse_period_us);
+    // Takes effect from the next time events are enabled
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
 
-    // Stop pulse train if positive counter falls to zero;
-    // counters which started zero or negative repeat indefinitely
-    if (pulse_train->pulse_count > 0 && --pulse_train->pulse_count == 0)
+void write_analog_pulse_sample_delay(msg_t& msg)
+{
+    uint32_t sample_delay = app_regs.analog_pulse_sample_delay;
+    HarpCore::copy_msg_payload_to_register(msg);
+    if (app_regs.analog_pulse_sample_delay > pulse_sample_max_delay_us)
     {
-        pulse_train->timer.delay_us = 0;
+        app_regs.analog_pulse_sample_delay = sample_delay;
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
     }
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
 
-    // For every pulse in the pulse train, arm an alarm matching the pulse width
-    add_alarm_in_us(pulse_train->pulse_width_us, pulse_callback, pulse_train, true);
+void write_analog_statistics_enable(msg_t& msg)
+{
+    uint8_t statistics_enable = app_regs.analog_statistics_enable;
+    HarpCore::copy_msg_payload_to_register(msg);
+    if (app_regs.analog_statistics_enable > 1)
+    {
+        app_regs.analog_statistics_enable = statistics_enable;
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
 
-    gpio_set_mask(pulse_train->output_mask << DO0_PIN);
-    HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 1);
-    return pulse_train->timer.delay_us != 0;
+    // Takes effect from the next frame window
+    analog_batch_frames = 0;
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
 }
 
-void write_start_pulse_train(msg_t& msg)
+void write_analog_calibration(msg_t& msg)
 {
+    int16_t calibration_offset[AI_CHANNEL_COUNT];
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+        calibration_offset[i] = app_regs.analog_calibration_offset[i];
     HarpCore::copy_msg_payload_to_register(msg);
 
-    // Configure pulse train parameters
-    uint8_t output_mask = (uint8_t)((app_regs.start_pulse_train[0] & 0xFF));
-    pulse_train_t *pulse_train = &pulse_train_timers[output_mask];
-    pulse_train->output_mask = output_mask;
-    pulse_train->pulse_width_us = app_regs.start_pulse_train[1];
-    pulse_train->pulse_period_us = app_regs.start_pulse_train[2];
-    pulse_train->pulse_count = app_regs.start_pulse_train[3];
-    
-    // Cancel any existing timer
-    if (cancel_repeating_timer(&pulse_train->timer))
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
     {
-        app_regs.stop_pulse_train = output_mask;
-        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 6);
+        int16_t offset = app_regs.analog_calibration_offset[i];
+        if (offset < -CALIBRATION_MAX_OFFSET || offset > CALIBRATION_MAX_OFFSET)
+        {
+            for (uint32_t j = 0; j < AI_CHANNEL_COUNT; j++)
+                app_regs.analog_calibration_offset[j] = calibration_offset[j];
+            HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+            return;
+        }
     }
 
-    // Arm repeating timer and immediately arm the first pulse
+    // Calibration is applied immediately without restarting acquisition
+    update_calibration_config();
     HarpCore::send_harp_reply(WRITE, msg.header.address);
-    add_repeating_timer_us(0, pulse_train_callback, pulse_train, &pulse_train->timer);
 }
 
-void write_stop_pulse_train(msg_t& msg)
+void write_analog_calibration_command(msg_t& msg)
 {
     HarpCore::copy_msg_payload_to_register(msg);
+    switch (app_regs.analog_calibration_command)
+    {
+        case CALIBRATION_STORE:
+            store_calibration();
+            break;
+        case CALIBRATION_LOAD:
+            if (!load_calibration())
+            {
+                HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+                return;
+            }
+            break;
+        case CALIBRATION_CLEAR:
+            clear_calibration();
+            break;
+        default:
+            HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+            return;
+    }
 
-    uint8_t output_mask = (uint8_t)((app_regs.start_pulse_train[0] & 0xFF));
-    cancel_repeating_timer(&pulse_train_timers[output_mask].timer);
+    update_calibration_config();
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
 
+void write_analog_biquad(msg_t& msg)
+{
+    uint8_t biquad_sections[AI_CHANNEL_COUNT];
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+        biquad_sections[i] = app_regs.analog_biquad_sections[i];
+    HarpCore::copy_msg_payload_to_register(msg);
+
+    bool valid = validate_biquad_rate(adc_layout, adc_timing);
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+        valid &= app_regs.analog_biquad_sections[i] <= BIQUAD_MAX_SECTIONS;
+    if (!valid)
+    {
+        for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+            app_regs.analog_biquad_sections[i] = biquad_sections[i];
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+
+    update_biquad_config();
     HarpCore::send_harp_reply(WRITE, msg.header.address);
 }
 
-bool adc_callback(repeating_timer_t *rt)
+void write_analog_envelope(msg_t& msg)
 {
-    if (!HarpCore::events_enabled())
-        return false;
+    uint8_t envelope_mode[AI_CHANNEL_COUNT];
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+        envelope_mode[i] = app_regs.analog_envelope_mode[i];
+    HarpCore::copy_msg_payload_to_register(msg);
 
-    rt->delay_us = -adc_period_us;
-    
-    // Mask the values to 12 bits (0xFFF) to ensure only valid ADC bits are used
-    adc_queue_item_t item;
-    item.timestamp = HarpCore::harp_time_us_64();
-    item.analog_data[0] = adc_vals[0] & 0xFFF;
-    item.analog_data[1] = adc_vals[1] & 0xFFF;
-    item.analog_data[2] = adc_vals[2] & 0xFFF;
-    queue_add_blocking(&adc_queue, &item);
-    return true;
+    for (uint32_t i = 0; i < AI_CHANNEL_COUNT; i++)
+    {
+        if (app_regs.analog_envelope_mode[i] >= ENVELOPE_MODE_COUNT)
+        {
+            for (uint32_t j = 0; j < AI_CHANNEL_COUNT; j++)
+                app_regs.analog_envelope_mode[j] = envelope_mode[j];
+            HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+            return;
+        }
+    }
+
+    update_envelope_config();
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
+}
+
+void write_analog_data_format(msg_t& msg)
+{
+    uint8_t data_format = app_regs.analog_data_format;
+    HarpCore::copy_msg_payload_to_register(msg);
+    if (app_regs.analog_data_format >= ANALOG_FORMAT_COUNT)
+    {
+        app_regs.analog_data_format = data_format;
+        HarpCore::send_harp_reply(WRITE_ERROR, msg.header.address);
+        return;
+    }
+
+    analog_batch_frames = 0;
+    HarpCore::send_harp_reply(WRITE, msg.header.address);
 }
 
 // Define register read-and-write handler functions.
@@ -234,11 +1981,70 @@ RegFnPair reg_handler_fns[reg_count]
     {&HarpCore::read_reg_generic, &write_do_state},
     {&HarpCore::read_reg_generic, &write_start_pulse_train},
     {&HarpCore::read_reg_generic, &write_stop_pulse_train},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_analog_config},
+    {&HarpCore::read_reg_generic, &write_analog_config},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_analog_config},
+    {&HarpCore::read_reg_generic, &write_analog_config},
+    {&HarpCore::read_reg_generic, &write_analog_config},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_analog_threshold},
+    {&HarpCore::read_reg_generic, &write_analog_threshold},
+    {&HarpCore::read_reg_generic, &write_analog_threshold},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_analog_data_enable},
+    {&HarpCore::read_reg_generic, &write_analog_reflex},
+    {&HarpCore::read_reg_generic, &write_analog_reflex},
+    {&HarpCore::read_reg_generic, &write_analog_reflex},
+    {&HarpCore::read_reg_generic, &write_analog_capture},
+    {&HarpCore::read_reg_generic, &write_analog_capture},
+    {&HarpCore::read_reg_generic, &write_analog_capture},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_analog_start_delay},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_analog_statistics_enable},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_analog_calibration},
+    {&HarpCore::read_reg_generic, &write_analog_calibration},
+    {&HarpCore::read_reg_generic, &write_analog_calibration_command},
+    {&HarpCore::read_reg_generic, &write_analog_biquad},
+    {&HarpCore::read_reg_generic, &write_analog_biquad},
+    {&HarpCore::read_reg_generic, &write_analog_data_format},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &HarpCore::write_reg_generic},
+    {&HarpCore::read_reg_generic, &write_analog_pulse_sample_delay},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_analog_envelope},
+    {&HarpCore::read_reg_generic, &HarpCore::write_reg_generic},
+    {&HarpCore::read_reg_generic, &HarpCore::write_reg_generic},
+    {&HarpCore::read_reg_generic, &write_start_output_sequence},
+    {&HarpCore::read_reg_generic, &write_stop_output_sequence},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &write_pwm},
+    {&HarpCore::read_reg_generic, &write_pwm},
+    {&HarpCore::read_reg_generic, &write_pwm},
+    {&HarpCore::read_reg_generic, &write_pulse_train_report},
+    {&HarpCore::read_reg_generic, &write_pulse_train_report},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
+    {&HarpCore::read_reg_generic, &HarpCore::write_reg_generic},
+    {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error},
     {&HarpCore::read_reg_generic, &HarpCore::write_to_read_only_reg_error}
 };
 
 void app_reset()
 {
+    // Stop acquisition and the outputs before the registers they run from
+    // are reset, and restart acquisition once it is reconfigured
+    if (events_active)
+        disable_adc_events();
+    stop_pulse_trains(0xFF);
+    stop_output_sequence();
+    stop_pwm_outputs(0xFF);
+
     app_regs.di_state = 0;
     app_regs.do_set = 0;
     app_regs.do_clear = 0;
@@ -249,9 +2055,70 @@ void app_reset()
     app_regs.start_pulse_train[2] = 0;
     app_regs.start_pulse_train[3] = 0;
     app_regs.stop_pulse_train = 0;
-    app_regs.analog_data[0] = 0;
-    app_regs.analog_data[1] = 0;
-    app_regs.analog_data[2] = 0;
+    app_regs.analog_sample_rate = adc_default_sample_rate;
+    app_regs.analog_data_batch_size = 0;
+    memset((void*)app_regs.analog_data_batch, 0, sizeof(app_regs.analog_data_batch));
+    app_regs.analog_decimation = adc_default_decimation;
+    app_regs.analog_filter_order = adc_default_filter_order;
+    app_regs.analog_channel_enable = adc_default_channel_enable;
+    app_regs.analog_overrun = 0;
+    app_regs.analog_resync = 0;
+    app_regs.analog_pulse_sample_outputs = 0;
+    app_regs.analog_pulse_sample_delay = 0;
+    memset((void*)app_regs.analog_pulse_sample, 0, sizeof(app_regs.analog_pulse_sample));
+    memset((void*)app_regs.analog_envelope_mode, 0, sizeof(app_regs.analog_envelope_mode));
+    app_regs.pulse_train_start_time = 0;
+    memset((void*)app_regs.output_sequence, 0, sizeof(app_regs.output_sequence));
+    app_regs.start_output_sequence[0] = 0;
+    app_regs.start_output_sequence[1] = 0;
+    app_regs.stop_output_sequence = 0;
+    app_regs.output_sequence_state = 0;
+    for (uint32_t line = 0; line < DO_LINE_COUNT; line++)
+    {
+        app_regs.pwm_frequency[line] = pwm_default_frequency;
+        app_regs.pwm_duty_cycle[line] = pwm_default_duty_cycle;
+    }
+    // Pulse train reports are opt-in, so hosts which do not read them get the
+    // same messages as before reports existed
+    app_regs.pulse_train_report_mode = PULSE_REPORT_NONE;
+    app_regs.pulse_train_report_interval = 1;
+    memset((void*)app_regs.pulse_train_pulse, 0, sizeof(app_regs.pulse_train_pulse));
+    memset((void*)app_regs.pulse_train_summary, 0, sizeof(app_regs.pulse_train_summary));
+    app_regs.pulse_train_burst[0] = 1;
+    app_regs.pulse_train_burst[1] = 0;
+    app_regs.pulse_train_report_overrun = 0;
+    app_regs.analog_pulse_sample_overrun = 0;
+    app_regs.analog_threshold_enable = 0;
+    memset((void*)app_regs.analog_threshold, 0, sizeof(app_regs.analog_threshold));
+    memset((void*)app_regs.analog_hysteresis, 0, sizeof(app_regs.analog_hysteresis));
+    app_regs.analog_threshold_crossing = 0;
+    app_regs.analog_data_enable = 1;
+    memset((void*)app_regs.analog_reflex_action, 0, sizeof(app_regs.analog_reflex_action));
+    memset((void*)app_regs.analog_reflex_output, 0, sizeof(app_regs.analog_reflex_output));
+    app_regs.analog_reflex_pulse_train[0] = 0;
+    app_regs.analog_reflex_pulse_train[1] = 0;
+    app_regs.analog_reflex_pulse_train[2] = 0;
+    app_regs.analog_capture_trigger = CAPTURE_TRIGGER_NONE;
+    app_regs.analog_capture_digital_input = 0;
+    app_regs.analog_capture_window[0] = capture_default_pre_trigger;
+    app_regs.analog_capture_window[1] = capture_default_post_trigger;
+    memset((void*)app_regs.analog_capture_data, 0, sizeof(app_regs.analog_capture_data));
+    capture_state = CAPTURE_IDLE;
+    app_regs.analog_start_delay = adc_default_start_delay_us;
+    app_regs.analog_start_latency = 0;
+    app_regs.analog_statistics_enable = 0;
+    memset((void*)app_regs.analog_statistics, 0, sizeof(app_regs.analog_statistics));
+    app_regs.analog_calibration_command = CALIBRATION_NONE;
+    if (!load_calibration())
+        clear_calibration();
+    memset((void*)app_regs.analog_biquad_sections, 0, sizeof(app_regs.analog_biquad_sections));
+    memset((void*)app_regs.analog_biquad_coefficients, 0, sizeof(app_regs.analog_biquad_coefficients));
+    app_regs.analog_data_format = ANALOG_FORMAT_UNPACKED;
+    memset((void*)app_regs.analog_data_packed, 0, sizeof(app_regs.analog_data_packed));
+    memset((void*)app_regs.analog_data_compressed, 0, sizeof(app_regs.analog_data_compressed));
+    update_adc_config();
+    if (events_active)
+        enable_adc_events();
 }
 
 void configure_gpio(void)
@@ -269,6 +2136,37 @@ void configure_gpio(void)
     gpio_set_irq_enabled(14, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true);
 }
 
+void configure_pulse_trains(void)
+{
+    // Raise the PIO interrupts when any train completes its last pulse
+    PIO pulse_pio[pulse_pio_count] = {pio0, pio1};
+    for (uint32_t i = 0; i < pulse_pio_count; i++)
+    {
+        pio_claim_sm_mask(pulse_pio[i], (1u << NUM_PIO_STATE_MACHINES) - 1);
+        pulse_program_offset[i] = pio_add_program(pulse_pio[i], &pulse_train_program);
+        pio_set_irq0_source_mask_enabled(pulse_pio[i], 0xFu << pis_interrupt0, true);
+    }
+    irq_set_exclusive_handler(PIO0_IRQ_0, pulse_train_irq_callback);
+    irq_set_exclusive_handler(PIO1_IRQ_0, pulse_train_irq_callback);
+    irq_set_enabled(PIO0_IRQ_0, true);
+    irq_set_enabled(PIO1_IRQ_0, true);
+
+    // Start scheduled trains ahead of every other interrupt
+    pulse_start_alarm = hardware_alarm_claim_unused(true);
+    hardware_alarm_set_callback(pulse_start_alarm, pulse_start_callback);
+    irq_set_priority(TIMER_IRQ_0 + pulse_start_alarm, PICO_HIGHEST_IRQ_PRIORITY);
+}
+
+void configure_output_sequence(void)
+{
+    // Sequences borrow the state machines of the pulse channels
+    PIO sequence_pio[pulse_pio_count] = {pio0, pio1};
+    for (uint32_t i = 0; i < pulse_pio_count; i++)
+        sequence_program_offset[i] = pio_add_program(sequence_pio[i], &output_sequence_program);
+    sequence_data_channel = dma_claim_unused_channel(true);
+    sequence_ctrl_channel = dma_claim_unused_channel(true);
+}
+
 void enable_gpio(bool enabled)
 {
     irq_set_enabled(IO_IRQ_BANK0, enabled);
@@ -281,8 +2179,6 @@ void configure_adc(void)
     adc_gpio_init(AI2_PIN);
 
     adc_init();
-    adc_set_clkdiv(0); // Run conversion back-to-back at full speed.
-    adc_set_round_robin(AI_MASK); // Enable round-robin sampling of all 3 inputs.
     adc_fifo_setup(
         true,    // Write each completed conversion to the sample FIFO
         true,    // Enable DMA data request (DREQ)
@@ -303,7 +2199,8 @@ void configure_adc(void)
     channel_config_set_transfer_data_size(&sample_config, DMA_SIZE_16);
     channel_config_set_read_increment(&sample_config, false); // read from adc FIFO reg.
     channel_config_set_write_increment(&sample_config, true);
-    channel_config_set_irq_quiet(&sample_config, true);
+    channel_config_set_ring(&sample_config, true, adc_ring_bits); // wrap write address around the ring.
+    channel_config_set_irq_quiet(&sample_config, false); // raise IRQ on every completed block.
     channel_config_set_dreq(&sample_config, DREQ_ADC); // pace data according to ADC
     channel_config_set_chain_to(&sample_config, adc_ctrl_channel);
     channel_config_set_enable(&sample_config, true);
@@ -312,15 +2209,16 @@ void configure_adc(void)
     dma_channel_configure(
         adc_sample_channel, // Channel to be configured
         &sample_config,
-        nullptr,            // write (dst) address will be loaded by adc_ctrl_channel.
+        adc_ring,           // write (dst) address wraps around the ring.
         &adc_hw->fifo,      // read (source) address. Does not change.
-        count_of(adc_vals), // Number of word transfers.
+        adc_block_capacity, // Number of word transfers. Updated from the sample rate.
         false               // Don't Start immediately.
     );
 
     // Setup Reconfiguration Channel
-    // This channel will Write the starting address to the write address
-    // "trigger" register, which will restart the DMA Sample Channel.
+    // This channel will Write the block length to the transfer count
+    // "trigger" register, which will restart the DMA Sample Channel
+    // from where its write address left off in the ring.
     channel_config_set_transfer_data_size(&ctrl_config, DMA_SIZE_32);
     channel_config_set_read_increment(&ctrl_config, false); // read a single uint32.
     channel_config_set_write_increment(&ctrl_config, false);
@@ -332,32 +2230,68 @@ void configure_adc(void)
     dma_channel_configure(
         adc_ctrl_channel,  // Channel to be configured
         &ctrl_config,
-        &dma_hw->ch[adc_sample_channel].al2_write_addr_trig, // dst address. Retrigger on write.
-        data_ptr,      // Read (src) address is a single array with the starting address.
+        &dma_hw->ch[adc_sample_channel].al1_transfer_count_trig, // dst address. Retrigger on write.
+        &adc_block_length, // Read (src) address is the current block length.
         1,             // Number of word transfers.
         false          // Don't Start immediately.
     );
 
-    // Configure queue for storing sample data and avoid concurrency in
-    // outbound message buffers, i.e. avoid sending reply in timer callback.
-    queue_init(&adc_queue, sizeof(adc_queue_item_t), 2);
+    // Raise the shared DMA interrupt whenever a sample block is completed.
+    irq_add_shared_handler(DMA_IRQ_0, adc_dma_callback, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
 }
 
-void enable_adc_events()
+int64_t adc_start_callback(alarm_id_t id, void *user_data)
 {
+    adc_start_alarm = 0;
+
     // Set starting ADC channel for round-robin mode.
-    adc_select_input(0);
+    adc_select_input(adc_layout.inputs[0]);
 
-    // Start free-running ADC and DMA transfer
-    dma_channel_start(adc_ctrl_channel);
+    // Start hardware-paced ADC and DMA transfer, keeping track of the
+    // start time to reconstruct the timestamp of every conversion.
+    dma_channel_start(adc_sample_channel);
+    adc_start_time_us = time_us_64();
     adc_run(true);
+    return 0;
+}
+
+void reset_adc_acquisition()
+{
+    // Size the first block to end exactly with the first reported frame,
+    // so it is available without waiting for a full block period.
+    uint32_t first_frame_length = adc_layout.channel_count * adc_timing.oversampling * adc_filter_order;
+    adc_pending_block_length = first_frame_length <= adc_block_capacity ? first_frame_length : adc_block_length;
+    dma_channel_set_write_addr(adc_sample_channel, adc_ring, false);
+    dma_channel_set_trans_count(adc_sample_channel, adc_pending_block_length, false);
+    dma_channel_acknowledge_irq0(adc_sample_channel);
+    dma_channel_set_irq0_enabled(adc_sample_channel, true);
 
-    // Setup repeating timer for reporting values back to the host.
-    add_repeating_timer_us(-adc_callback_delay_us, adc_callback, NULL, &adc_timer);
+    // Reset ring and frame accumulators
+    adc_ring_index = 0;
+    adc_conversion_count = 0;
+    adc_frame_start = 0;
+    adc_channel_index = 0;
+    adc_scan_count = 0;
+    adc_settle_frames = adc_filter_order - 1;
+    for (uint32_t channel = 0; channel < adc_layout.channel_count; channel++)
+    {
+        cic_reset(adc_filters[channel]);
+        threshold_reset(adc_detectors[channel]);
+        statistics_reset(adc_statistics[channel]);
+        biquad_reset(adc_biquads[channel]);
+        envelope_reset(adc_envelopes[channel]);
+    }
+    adc_statistics_enabled = app_regs.analog_statistics_enable;
+    adc_threshold_state = 0;
+    reset_capture();
 }
 
-void disable_adc_events()
+void stop_adc_acquisition()
 {
+    // Disable the block interrupt first so aborting cannot raise it
+    dma_channel_set_irq0_enabled(adc_sample_channel, false);
+
     // Ensure both DMA channels are fully stopped
     // Note: loop is needed since dma_channel_abort does not wait for CHAN_ABORT
     // https://github.com/raspberrypi/pico-sdk/issues/923
@@ -366,20 +2300,248 @@ void disable_adc_events()
         dma_channel_abort(adc_sample_channel);
     }
 
-    // Stop the ADC and drain the FIFO.
+    // Stop the ADC and wait for any conversion in flight before draining the
+    // FIFO, so the next start cannot pick up a sample from the previous scan.
     adc_run(false);
+    while (!(adc_hw->cs & ADC_CS_READY_BITS))
+        tight_loop_contents();
     adc_fifo_drain();
+    hw_set_bits(&adc_hw->fcs, ADC_FCS_OVER_BITS); // Write 1 to clear.
+}
+
+void enable_adc_events()
+{
+    adc_enable_time_us = time_us_64();
+
+    // Scan only the enabled channels, powering the temperature sensor if needed.
+    adc_set_round_robin(adc_layout.round_robin_mask);
+    adc_set_temp_sensor_enabled(adc_layout.round_robin_mask & (1u << ADC_TEMPERATURE_INPUT));
+
+    // Pace the ADC clock so that every conversion lands on the frame grid,
+    // and size blocks so the DMA interrupt fires about once per millisecond.
+    adc_compute_timing(app_regs.analog_sample_rate, adc_layout.channel_count, app_regs.analog_decimation, adc_timing);
+    adc_filter_order = app_regs.analog_filter_order;
+    cic_compute_gain(adc_timing.oversampling, adc_filter_order, adc_filter_gain);
+    // Reflexes can only react once a block is complete, so blocks are kept short.
+    uint32_t block_period_us = adc_reflex_slots ? adc_reflex_block_period_us : adc_block_period_us;
+    adc_block_length = (uint64_t)adc_conversion_rate(adc_timing) * block_period_us / 1000000;
+    adc_block_length = adc_block_length < 1 ? 1
+        : adc_block_length > adc_block_capacity ? adc_block_capacity
+        : adc_block_length;
+    adc_hw->div = adc_timing.clkdiv;
+
+    // Reset queues and batch accumulators. Frames are queued to avoid
+    // concurrency in outbound message buffers, i.e. avoid sending reply in DMA callback.
+    spsc_queue_reset(adc_queue);
+    spsc_queue_reset(adc_event_queue);
+    adc_frame_sequence = 0;
+    analog_next_sequence = 0;
+    analog_batch_frames = 0;
+    adc_first_frame_pending = true;
+    adc_start_latency_ready = false;
+    adc_resync_ready = false;
+    spsc_queue_reset(pulse_sample_queue);
+    reset_adc_acquisition();
+
+    // Optionally delay the start of acquisition before reporting values back to the host.
+    if (app_regs.analog_start_delay > 0)
+        adc_start_alarm = add_alarm_in_us(app_regs.analog_start_delay, adc_start_callback, NULL, true);
+    else
+        adc_start_callback(0, NULL);
+}
+
+void disable_adc_events()
+{
+    if (adc_start_alarm > 0)
+    {
+        cancel_alarm(adc_start_alarm);
+        adc_start_alarm = 0;
+    }
+
+    stop_adc_acquisition();
+    adc_set_temp_sensor_enabled(false);
+}
+
+void resync_adc()
+{
+    // Restart the round robin from the first enabled channel, skipping a frame
+    // sequence number so batches are never assembled across the gap.
+    adc_resync_timestamp = adc_conversion_time_us(adc_conversion_count);
+    stop_adc_acquisition();
+    reset_adc_acquisition();
+    adc_frame_sequence++;
+    app_regs.analog_resync++;
+    adc_resync_ready = true;
+    adc_start_callback(0, NULL);
+}
+
+// Sends the frames accumulated so far, which is fewer than the batch size
+// when the batch is cut short by a gap in the frame sequence.
+void send_analog_batch()
+{
+    uint32_t count = analog_batch_frames * adc_layout.channel_count;
+    if (app_regs.analog_data_format == ANALOG_FORMAT_COMPRESSED)
+    {
+        app_reg_specs[38].num_bytes = analog_encoder.length;
+        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 38, analog_batch_timestamp);
+    }
+    else if (app_regs.analog_data_format == ANALOG_FORMAT_PACKED)
+    {
+        pack12((const uint16_t*)app_regs.analog_data_batch, count, (uint8_t*)app_regs.analog_data_packed);
+        app_reg_specs[37].num_bytes = pack12_size(count);
+        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 37, analog_batch_timestamp);
+    }
+    else
+    {
+        app_reg_specs[10].num_bytes = count * sizeof(uint16_t);
+        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 10, analog_batch_timestamp);
+    }
+    analog_batch_frames = 0;
 }
 
-void cancel_pulse_timers()
+void report_analog_frame(const adc_queue_item_t& item)
 {
-    // Cancel any pulse train timer which might be still running
-    for (size_t i = 0; i < pulse_train_count; i++)
+    // Frames in a batch are timestamped implicitly, so they must be consecutive
+    if (item.sequence != analog_next_sequence && analog_batch_frames > 0)
+        send_analog_batch();
+    analog_next_sequence = item.sequence + 1;
+
+    if (item.has_statistics)
+    {
+        uint32_t count = analog_statistics_count * adc_layout.channel_count;
+        for (uint32_t i = 0; i < count; i++)
+            app_regs.analog_statistics[i] = item.statistics[i];
+        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 30, item.timestamp);
+    }
+    else if (app_regs.analog_data_format == ANALOG_FORMAT_COMPRESSED)
+    {
+        // Start each message with a keyframe timestamped with its first frame
+        uint8_t* buffer = (uint8_t*)app_regs.analog_data_compressed;
+        if (analog_batch_frames == 0)
+        {
+            analog_batch_timestamp = item.timestamp;
+            delta_begin(analog_encoder, adc_layout.channel_count, buffer);
+        }
+
+        delta_add_frame(analog_encoder, item.analog_data, buffer);
+        analog_batch_frames = analog_encoder.frames;
+        uint32_t frame_size = delta_max_frame_size(adc_layout.channel_count);
+        if (analog_batch_frames == app_regs.analog_data_batch_size ||
+            analog_encoder.length + frame_size > analog_compressed_capacity)
+            send_analog_batch();
+    }
+    else if (app_regs.analog_data_batch_size == 0 && app_regs.analog_data_format == ANALOG_FORMAT_UNPACKED)
+    {
+        // Map each enabled channel to its fixed field; disabled channels report
+        // zero, and the temperature field is only sent while it is enabled
+        for (uint32_t channel = 0; channel < adc_layout.channel_count; channel++)
+        {
+            uint32_t index = analog_field_index(adc_layout.inputs[channel]);
+            app_regs.analog_data[index] = item.analog_data[channel];
+        }
+        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 7, item.timestamp);
+    }
+    else
+    {
+        // The batch is timestamped with the first frame, and subsequent
+        // frames follow at the implicit AnalogSampleRate interval.
+        if (analog_batch_frames == 0)
+            analog_batch_timestamp = item.timestamp;
+
+        volatile uint16_t* frame = &app_regs.analog_data_batch[analog_batch_frames * adc_layout.channel_count];
+        for (uint32_t channel = 0; channel < adc_layout.channel_count; channel++)
+            frame[channel] = item.analog_data[channel];
+        if (++analog_batch_frames >= app_regs.analog_data_batch_size)
+            send_analog_batch();
+    }
+}
+
+void report_pulse_sample(const pulse_sample_item_t& item)
+{
+    volatile uint32_t* payload = app_regs.analog_pulse_sample;
+    *payload++ = item.output_mask;
+    *payload++ = item.pulse_index;
+    for (uint32_t channel = 0; channel < adc_layout.channel_count; channel++)
+        *payload++ = item.analog_data[channel];
+    app_reg_specs[42].num_bytes = (pulse_sample_header_count + adc_layout.channel_count) * sizeof(uint32_t);
+    HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 42, item.timestamp);
+}
+
+// Reports the pulses of every recorded train which have elapsed since the
+// last iteration, and the summary of trains whose pulses are all reported
+// once they stop.
+void report_pulse_trains()
+{
+    uint64_t now_us = time_us_64();
+    for (uint32_t i = 0; i < PULSE_REPORT_CAPACITY; i++)
     {
-        cancel_repeating_timer(&pulse_train_timers[i].timer);
+        pulse_report_t& report = pulse_reports[i];
+        uint32_t status = save_and_disable_interrupts();
+        bool active = report.active;
+        bool stopped = report.stopped;
+        uint64_t stop_time_us = report.stop_time_us;
+        uint32_t stop_count = report.stop_count;
+        restore_interrupts(status);
+        if (!active)
+            continue;
+
+        uint32_t edges = stopped ? stop_count
+                                 : pulse_report_edges(report.start_time_us, report.pulse_period_us, report.pulse_count,
+                                                      report.burst_period_us, report.burst_count, now_us);
+        for (uint32_t reported = 0; reported < pulse_report_batch; reported++)
+        {
+            uint32_t index = pulse_report_next(report.mode, report.interval, report.next_index);
+            if (index >= edges)
+            {
+                report.next_index = edges;
+                break;
+            }
+
+            uint64_t edge_time_us = report.start_time_us + pulse_edge_offset_us(index, report.pulse_period_us,
+                                                                                report.pulse_count, report.burst_period_us);
+            app_regs.pulse_train_pulse[0] = report.train_mask;
+            app_regs.pulse_train_pulse[1] = index;
+            HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 54,
+                                      HarpCore::system_to_harp_us_64(edge_time_us));
+            report.next_index = index + 1;
+        }
+
+        if (stopped && report.next_index >= edges)
+        {
+            uint64_t last_time_us = report.start_time_us + pulse_edge_offset_us(edges - 1, report.pulse_period_us,
+                                                                                report.pulse_count, report.burst_period_us);
+            app_regs.pulse_train_summary[0] = report.train_mask;
+            app_regs.pulse_train_summary[1] = edges;
+            app_regs.pulse_train_summary[2] = edges > 0 ? HarpCore::system_to_harp_us_64(report.start_time_us) : 0;
+            app_regs.pulse_train_summary[3] = edges > 0 ? HarpCore::system_to_harp_us_64(last_time_us) : 0;
+            HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 55,
+                                      HarpCore::system_to_harp_us_64(stop_time_us));
+            status = save_and_disable_interrupts();
+            report.active = false;
+            restore_interrupts(status);
+        }
     }
 }
 
+void stream_capture_chunk()
+{
+    // Send whole scans per message, timestamped with their first conversion
+    uint32_t chunk_length = analog_batch_capacity - analog_batch_capacity % adc_layout.channel_count;
+    uint32_t remaining = capture_length - capture_sent;
+    if (chunk_length > remaining)
+        chunk_length = remaining;
+
+    for (uint32_t i = 0; i < chunk_length; i++)
+        app_regs.analog_capture_data[i] = capture_buffer[capture_sent + i] & 0xFFF;
+    app_reg_specs[26].num_bytes = chunk_length * sizeof(uint16_t);
+    uint64_t timestamp = adc_conversion_time_us(capture_start + capture_sent);
+    HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 26, timestamp);
+
+    capture_sent += chunk_length;
+    if (capture_sent >= capture_length)
+        reset_capture();
+}
+
 void update_app_state()
 {
     // Enable or disable asynchronous register updates depending on app state
@@ -395,16 +2557,57 @@ void update_app_state()
         // disable events
         enable_gpio(false);
         disable_adc_events();
-        cancel_pulse_timers();
+        stop_pulse_trains(0xFF);
+        stop_output_sequence();
+        stop_pwm_outputs(0xFF);
+        pwm_enable_changed = false;
+        for (uint32_t i = 0; i < PULSE_REPORT_CAPACITY; i++)
+            pulse_reports[i].active = false;
         events_active = false;
     }
 
-    if (events_active && queue_try_remove(&adc_queue, &adc_queue_current))
+    // Drain the events and frames pending at the start of this iteration, so a fast
+    // producer cannot starve the rest of the main loop.
+    if (events_active)
     {
-        app_regs.analog_data[0] = adc_queue_current.analog_data[0];
-        app_regs.analog_data[1] = adc_queue_current.analog_data[1];
-        app_regs.analog_data[2] = adc_queue_current.analog_data[2];
-        HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 7, adc_queue_current.timestamp);
+        uint32_t events = spsc_queue_level(adc_event_queue);
+        while (events-- > 0 && spsc_queue_try_remove(adc_event_queue, adc_event_current))
+        {
+            *app_reg_specs[adc_event_current.reg_index].base_ptr = adc_event_current.value;
+            HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + adc_event_current.reg_index, adc_event_current.timestamp);
+        }
+
+        uint32_t pending = spsc_queue_level(adc_queue);
+        while (pending-- > 0 && spsc_queue_try_remove(adc_queue, adc_queue_current))
+            report_analog_frame(adc_queue_current);
+
+        uint32_t samples = spsc_queue_level(pulse_sample_queue);
+        while (samples-- > 0 && spsc_queue_try_remove(pulse_sample_queue, pulse_sample_current))
+            report_pulse_sample(pulse_sample_current);
+
+        report_pulse_trains();
+
+        if (adc_start_latency_ready)
+        {
+            adc_start_latency_ready = false;
+            HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 28, adc_start_latency_timestamp);
+        }
+
+        if (adc_resync_ready)
+        {
+            adc_resync_ready = false;
+            HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 39, adc_resync_timestamp);
+        }
+
+        if (pwm_enable_changed)
+        {
+            pwm_enable_changed = false;
+            HarpCore::send_harp_reply(EVENT, APP_REG_START_ADDRESS + 49);
+        }
+
+        // Stream a single chunk of a frozen capture per iteration
+        if (capture_state == CAPTURE_READY)
+            stream_capture_chunk();
     }
 }
 
@@ -425,7 +2628,10 @@ int main()
 // Init Synchronizer.
     HarpSynchronizer& sync = HarpSynchronizer::init(uart1, 5);
     app.set_synchronizer(&sync);
+    app_reset();
     configure_gpio();
+    configure_pulse_trains();
+    configure_output_sequence();
     configure_adc();
     
     while(true)
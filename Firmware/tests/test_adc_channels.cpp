@@ -0,0 +1,57 @@
+#include <adc_channels.h>
+#include "test_common.h"
+
+// Every valid mask scans its inputs in ascending order, and the round-robin
+// value is the mask itself.
+void test_valid_masks()
+{
+    for (uint32_t mask = 1; mask <= ADC_CHANNEL_MASK; mask++)
+    {
+        if (mask & ~ADC_CHANNEL_MASK)
+            continue;
+
+        adc_frame_layout_t layout;
+        CHECK(adc_compute_frame_layout(mask, layout));
+        CHECK(layout.round_robin_mask == mask);
+        CHECK(layout.channel_count == (uint32_t)__builtin_popcount(mask));
+        for (uint32_t i = 0; i < layout.channel_count; i++)
+        {
+            CHECK(mask & (1u << layout.inputs[i]));
+            if (i > 0)
+                CHECK(layout.inputs[i] > layout.inputs[i - 1]);
+        }
+    }
+}
+
+void test_temperature_sensor()
+{
+    adc_frame_layout_t layout;
+    CHECK(adc_compute_frame_layout(0x11, layout));
+    CHECK(layout.channel_count == 2);
+    CHECK(layout.inputs[0] == 0);
+    CHECK(layout.inputs[1] == ADC_TEMPERATURE_INPUT);
+
+    CHECK(adc_compute_frame_layout(1u << ADC_TEMPERATURE_INPUT, layout));
+    CHECK(layout.channel_count == 1);
+    CHECK(layout.inputs[0] == ADC_TEMPERATURE_INPUT);
+}
+
+// Empty masks and inputs without an analog channel are rejected, e.g. GPIO29
+// on input 3, which measures VSYS on the Pico.
+void test_invalid_masks()
+{
+    adc_frame_layout_t layout;
+    CHECK(!adc_compute_frame_layout(0, layout));
+    CHECK(!adc_compute_frame_layout(0x08, layout));
+    CHECK(!adc_compute_frame_layout(0x0F, layout));
+    CHECK(!adc_compute_frame_layout(0x20, layout));
+    CHECK(!adc_compute_frame_layout(0xFF, layout));
+}
+
+int main()
+{
+    test_valid_masks();
+    test_temperature_sensor();
+    test_invalid_masks();
+    return test_result();
+}
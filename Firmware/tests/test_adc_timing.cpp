@@ -0,0 +1,86 @@
+#include <cmath>
+#include <adc_timing.h>
+#include "test_common.h"
+
+// Checks the divider and oversampling of every supported frame rate against
+// the frame rate they actually produce.
+void test_frame_rates()
+{
+    const uint32_t rates[] = {1, 10, 250, 733, 1000, 10000, 100000, 500000};
+    const uint32_t decimations[] = {1, 4, 1024};
+    for (uint32_t rate : rates)
+    {
+        for (uint32_t channel_count = 1; channel_count <= 4; channel_count++)
+        {
+            for (uint32_t decimation : decimations)
+            {
+                adc_timing_t timing;
+                bool valid = adc_compute_timing(rate, channel_count, decimation, timing);
+                uint64_t min_cycles = (uint64_t)channel_count * decimation * ADC_MIN_PERIOD;
+                // Rates within rounding of the fastest conversion rate may go either way
+                uint64_t frame_cycles = ((uint64_t)ADC_CLOCK_HZ << ADC_DIV_FRAC_BITS) / rate;
+                if (frame_cycles >= min_cycles)
+                    CHECK(valid);
+                else if (frame_cycles + channel_count * decimation < min_cycles)
+                    CHECK(!valid);
+                if (!valid)
+                    continue;
+
+                CHECK(timing.period >= ADC_MIN_PERIOD);
+                CHECK(timing.period <= ADC_MAX_PERIOD);
+                CHECK(timing.clkdiv == timing.period - (1u << ADC_DIV_FRAC_BITS));
+                CHECK(timing.oversampling >= decimation);
+                CHECK(timing.oversampling % decimation == 0);
+
+                // One less multiple of the decimation would not fit the divider
+                if (timing.oversampling > decimation)
+                {
+                    double frame_cycles = (double)((uint64_t)ADC_CLOCK_HZ << ADC_DIV_FRAC_BITS) / rate;
+                    double period = frame_cycles / (channel_count * (timing.oversampling - decimation));
+                    CHECK(period > ADC_MAX_PERIOD);
+                }
+
+                double conversion_rate = (double)((uint64_t)ADC_CLOCK_HZ << ADC_DIV_FRAC_BITS) / timing.period;
+                double frame_rate = conversion_rate / (channel_count * timing.oversampling);
+                CHECK(std::fabs(frame_rate - rate) / rate < 1e-4);
+                CHECK(adc_conversion_rate(timing) == (uint32_t)conversion_rate);
+            }
+        }
+    }
+}
+
+void test_invalid_settings()
+{
+    adc_timing_t timing;
+    CHECK(!adc_compute_timing(0, 3, 1, timing));
+    CHECK(!adc_compute_timing(250, 0, 1, timing));
+    CHECK(!adc_compute_timing(250, 3, 0, timing));
+    CHECK(!adc_compute_timing(ADC_MAX_CONVERSION_RATE / 3 + 100, 3, 1, timing));
+    CHECK(adc_compute_timing(ADC_MAX_CONVERSION_RATE, 1, 1, timing));
+    CHECK(timing.period == ADC_MIN_PERIOD);
+}
+
+// Sample times reconstructed from the conversion count must map back to the
+// same conversion, or the one before it when the time is rounded down.
+void test_conversion_time()
+{
+    adc_timing_t timing;
+    CHECK(adc_compute_timing(250, 3, 1, timing));
+    for (uint64_t conversion = 0; conversion < 1000000; conversion += 997)
+    {
+        uint64_t time_us = adc_conversions_to_us(conversion, timing);
+        uint64_t converted = adc_us_to_conversions(time_us, timing);
+        CHECK(converted <= conversion);
+        CHECK(converted + 1 >= conversion);
+    }
+    CHECK(adc_us_to_conversions(1000000, timing) == 750);
+    CHECK(adc_conversions_to_us(750, timing) == 1000000);
+}
+
+int main()
+{
+    test_frame_rates();
+    test_invalid_settings();
+    test_conversion_time();
+    return test_result();
+}
@@ -0,0 +1,162 @@
+#include <cmath>
+#include <cstdlib>
+#include <biquad_filter.h>
+#include "test_common.h"
+
+const double coefficient_scale = (double)(1 << BIQUAD_COEFFICIENT_BITS);
+
+// Designs a second-order low-pass or high-pass section with the bilinear
+// transform, as given in the Audio EQ Cookbook, quantized to Q30.
+biquad_coefficients_t design_section(double cutoff, double q, bool high_pass)
+{
+    double w0 = 2 * M_PI * cutoff;
+    double alpha = std::sin(w0) / (2 * q);
+    double cosw0 = std::cos(w0);
+    double a0 = 1 + alpha;
+    double b0 = high_pass ? (1 + cosw0) / 2 : (1 - cosw0) / 2;
+    double b1 = high_pass ? -(1 + cosw0) : 1 - cosw0;
+    biquad_coefficients_t c;
+    c.b0 = (int32_t)std::lround(b0 / a0 * coefficient_scale);
+    c.b1 = (int32_t)std::lround(b1 / a0 * coefficient_scale);
+    c.b2 = c.b0;
+    c.a1 = (int32_t)std::lround(-2 * cosw0 / a0 * coefficient_scale);
+    c.a2 = (int32_t)std::lround((1 - alpha) / a0 * coefficient_scale);
+    return c;
+}
+
+// Double-precision model of the cascade using the same quantized coefficients,
+// so the comparison isolates the error of the fixed-point arithmetic.
+struct reference_cascade_t
+{
+    uint32_t section_count;
+    double b0[BIQUAD_MAX_SECTIONS], b1[BIQUAD_MAX_SECTIONS], b2[BIQUAD_MAX_SECTIONS];
+    double a1[BIQUAD_MAX_SECTIONS], a2[BIQUAD_MAX_SECTIONS];
+    double x1[BIQUAD_MAX_SECTIONS], x2[BIQUAD_MAX_SECTIONS];
+    double y1[BIQUAD_MAX_SECTIONS], y2[BIQUAD_MAX_SECTIONS];
+};
+
+reference_cascade_t make_reference(const biquad_cascade_t& cascade)
+{
+    reference_cascade_t reference = {};
+    reference.section_count = cascade.section_count;
+    for (uint32_t i = 0; i < cascade.section_count; i++)
+    {
+        const biquad_coefficients_t& c = cascade.coefficients[i];
+        reference.b0[i] = c.b0 / coefficient_scale;
+        reference.b1[i] = c.b1 / coefficient_scale;
+        reference.b2[i] = c.b2 / coefficient_scale;
+        reference.a1[i] = c.a1 / coefficient_scale;
+        reference.a2[i] = c.a2 / coefficient_scale;
+    }
+    return reference;
+}
+
+double reference_process(reference_cascade_t& reference, double x)
+{
+    for (uint32_t i = 0; i < reference.section_count; i++)
+    {
+        double y = reference.b0[i] * x + reference.b1[i] * reference.x1[i] + reference.b2[i] * reference.x2[i]
+                 - reference.a1[i] * reference.y1[i] - reference.a2[i] * reference.y2[i];
+        reference.x2[i] = reference.x1[i];
+        reference.x1[i] = x;
+        reference.y2[i] = reference.y1[i];
+        reference.y1[i] = y;
+        x = y;
+    }
+    return x;
+}
+
+// Runs both models over an input signal and returns the largest difference
+// between the filter output and the unrounded reference, in conversion units.
+template <typename Signal>
+double max_error(biquad_cascade_t cascade, Signal signal, uint32_t length)
+{
+    biquad_reset(cascade);
+    reference_cascade_t reference = make_reference(cascade);
+    double error = 0;
+    for (uint32_t n = 0; n < length; n++)
+    {
+        int32_t sample = signal(n);
+        int32_t output = biquad_process(cascade, sample);
+        double expected = reference_process(reference, sample);
+        if (expected < BIQUAD_OUTPUT_MIN || expected > BIQUAD_OUTPUT_MAX)
+            continue;
+        error = std::fmax(error, std::fabs(output - expected));
+    }
+    return error;
+}
+
+biquad_cascade_t make_cascade(uint32_t section_count, double cutoff, double q, bool high_pass)
+{
+    biquad_cascade_t cascade = {};
+    cascade.section_count = section_count;
+    for (uint32_t i = 0; i < section_count; i++)
+        cascade.coefficients[i] = design_section(cutoff, q, high_pass);
+    return cascade;
+}
+
+void test_reference_error(const biquad_cascade_t& cascade)
+{
+    const uint32_t length = 20000;
+    std::srand(1);
+    auto noise = [](uint32_t) { return std::rand() & 0xFFF; };
+    auto step = [](uint32_t n) { return (n / 2500) % 2 ? 0xFFF : 0; };
+    auto sine = [](uint32_t n) { return (int32_t)std::lround(2048 + 2047 * std::sin(2 * M_PI * n / 37.0)); };
+
+    // Rounding the output to the nearest conversion unit accounts for up to
+    // half an LSB, and the Q16 state may only add a small fraction of that.
+    const double bound = 0.5 + 1.0 / 64;
+    CHECK(max_error(cascade, noise, length) <= bound);
+    CHECK(max_error(cascade, step, length) <= bound);
+    CHECK(max_error(cascade, sine, length) <= bound);
+}
+
+void test_designs()
+{
+    test_reference_error(make_cascade(1, 0.02, M_SQRT1_2, false));
+    test_reference_error(make_cascade(1, 0.1, 2.0, false));
+    test_reference_error(make_cascade(1, 0.01, M_SQRT1_2, true));
+    test_reference_error(make_cascade(2, 0.005, M_SQRT1_2, false));
+    test_reference_error(make_cascade(2, 0.05, 0.54, true));
+}
+
+// An empty cascade passes samples through, and low-pass filters settle on
+// their input without offset.
+void test_passthrough_and_dc()
+{
+    biquad_cascade_t cascade = {};
+    for (int32_t sample = 0; sample <= 0xFFF; sample += 123)
+        CHECK(biquad_process(cascade, sample) == sample);
+
+    cascade = make_cascade(2, 0.01, M_SQRT1_2, false);
+    biquad_reset(cascade);
+    int32_t output = 0;
+    for (uint32_t n = 0; n < 10000; n++)
+        output = biquad_process(cascade, 3000);
+    CHECK(std::abs(output - 3000) <= 1);
+}
+
+void test_output_clamp()
+{
+    biquad_cascade_t cascade = make_cascade(1, 0.02, M_SQRT1_2, true);
+    biquad_reset(cascade);
+    int32_t minimum = 0;
+    int32_t maximum = 0;
+    for (uint32_t n = 0; n < 1000; n++)
+    {
+        int32_t output = biquad_process(cascade, n % 200 < 100 ? 0xFFF : 0);
+        minimum = output < minimum ? output : minimum;
+        maximum = output > maximum ? output : maximum;
+    }
+    CHECK(minimum >= BIQUAD_OUTPUT_MIN);
+    CHECK(maximum <= BIQUAD_OUTPUT_MAX);
+    CHECK(minimum < 0);
+}
+
+int main()
+{
+    test_designs();
+    test_passthrough_and_dc();
+    test_output_clamp();
+    return test_result();
+}
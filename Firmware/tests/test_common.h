@@ -0,0 +1,27 @@
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+#include <cstdio>
+
+// Minimal checks for the host tests. Failed checks are printed and counted,
+// and the test returns a non-zero exit code if any check failed.
+static int test_failures = 0;
+
+#define CHECK(condition)                                                          \
+    do                                                                            \
+    {                                                                             \
+        if (!(condition))                                                         \
+        {                                                                         \
+            std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            test_failures++;                                                      \
+        }                                                                         \
+    } while (0)
+
+inline int test_result()
+{
+    if (test_failures > 0)
+        std::printf("%d check(s) failed\n", test_failures);
+    return test_failures > 0 ? 1 : 0;
+}
+
+#endif // TEST_COMMON_H
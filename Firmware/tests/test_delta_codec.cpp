@@ -0,0 +1,152 @@
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <delta_codec.h>
+#include "test_common.h"
+
+// Message capacity of AnalogDataCompressed, matching the 120 unpacked values
+// of AnalogDataBatch.
+const uint32_t message_capacity = 240;
+
+// Decodes a batch as the host does. Returns false if the batch is malformed.
+bool delta_decode(const uint8_t* buffer, uint32_t length, std::vector<uint16_t>& values)
+{
+    if (length < 1)
+        return false;
+    uint32_t channel_count = buffer[0];
+    if (channel_count == 0 || channel_count > DELTA_MAX_CHANNELS || length < 1 + 2 * channel_count)
+        return false;
+
+    uint16_t previous[DELTA_MAX_CHANNELS];
+    uint32_t index = 1;
+    for (uint32_t channel = 0; channel < channel_count; channel++, index += 2)
+    {
+        previous[channel] = buffer[index] | (buffer[index + 1] << 8);
+        values.push_back(previous[channel]);
+    }
+
+    uint32_t channel = 0;
+    while (index < length)
+    {
+        uint32_t delta = 0;
+        for (uint32_t shift = 0; ; shift += 7)
+        {
+            if (index >= length || shift > 28)
+                return false;
+            uint8_t byte = buffer[index++];
+            delta |= (uint32_t)(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                break;
+        }
+        int32_t difference = (int32_t)(delta >> 1) ^ -(int32_t)(delta & 1);
+        previous[channel] = (uint16_t)(previous[channel] + difference);
+        values.push_back(previous[channel]);
+        channel = (channel + 1) % channel_count;
+    }
+    return channel == 0;
+}
+
+// Compresses frames into messages the way the firmware fills them, checking
+// every message decodes back to its frames. Returns the compressed size of
+// the signal relative to its unpacked size.
+template <typename Signal>
+double round_trip(uint32_t channel_count, uint32_t frame_count, Signal signal)
+{
+    uint8_t buffer[message_capacity];
+    delta_encoder_t encoder;
+    std::vector<uint16_t> sent;
+    uint32_t compressed_bytes = 0;
+    for (uint32_t frame = 0; frame < frame_count; frame++)
+    {
+        if (frame == 0 || encoder.frames == 0)
+            delta_begin(encoder, channel_count, buffer);
+
+        uint16_t values[DELTA_MAX_CHANNELS];
+        for (uint32_t channel = 0; channel < channel_count; channel++)
+            values[channel] = signal(frame, channel) & 0xFFF;
+        delta_add_frame(encoder, values, buffer);
+        sent.insert(sent.end(), values, values + channel_count);
+        CHECK(encoder.length <= message_capacity);
+        CHECK(encoder.length <= 1 + encoder.frames * delta_max_frame_size(channel_count));
+
+        if (frame + 1 == frame_count || encoder.length + delta_max_frame_size(channel_count) > message_capacity)
+        {
+            std::vector<uint16_t> received;
+            CHECK(delta_decode(buffer, encoder.length, received));
+            CHECK(received == sent);
+            compressed_bytes += encoder.length;
+            sent.clear();
+            encoder.frames = 0;
+        }
+    }
+    return (double)compressed_bytes / (frame_count * channel_count * sizeof(uint16_t));
+}
+
+void test_zigzag()
+{
+    CHECK(zigzag_encode(0) == 0);
+    CHECK(zigzag_encode(-1) == 1);
+    CHECK(zigzag_encode(1) == 2);
+    CHECK(zigzag_encode(-4095) == 8189);
+    CHECK(zigzag_encode(4095) == 8190);
+}
+
+// Full-scale swings are the worst case, whose frames must still fit in their
+// uncompressed size.
+void test_worst_case()
+{
+    for (uint32_t channel_count = 1; channel_count <= DELTA_MAX_CHANNELS; channel_count++)
+    {
+        round_trip(channel_count, 1000, [](uint32_t frame, uint32_t channel) {
+            return (frame + channel) % 2 ? 0xFFF : 0;
+        });
+    }
+}
+
+void test_random()
+{
+    std::srand(2);
+    for (uint32_t channel_count = 1; channel_count <= 4; channel_count++)
+    {
+        round_trip(channel_count, 5000, [](uint32_t, uint32_t) { return std::rand(); });
+        round_trip(channel_count, 1, [](uint32_t, uint32_t) { return std::rand(); });
+    }
+}
+
+// Compression ratio of synthetic signals: a slow sine with a few LSB of noise
+// on three inputs, and a faster sine with heavy noise on four. The signals are
+// generated rather than recorded from the device, so the ratios only check
+// that smooth inputs compress and noisy ones do not expand. They do not
+// predict the compression of real recordings, which depends on the noise and
+// bandwidth of the connected sources.
+void benchmark_ratio()
+{
+    std::srand(3);
+    auto smooth = [](uint32_t frame, uint32_t channel) {
+        double phase = 2 * M_PI * frame / 500.0 + channel;
+        return (int32_t)std::lround(2048 + 1500 * std::sin(phase)) + std::rand() % 9 - 4;
+    };
+    auto noisy = [](uint32_t frame, uint32_t channel) {
+        double phase = 2 * M_PI * frame / 50.0 + channel;
+        return (int32_t)std::lround(2048 + 1500 * std::sin(phase)) + std::rand() % 129 - 64;
+    };
+
+    double smooth_ratio = round_trip(3, 100000, smooth);
+    double noisy_ratio = round_trip(4, 100000, noisy);
+    std::printf("synthetic compression ratio: smooth %.3f, noisy %.3f\n", smooth_ratio, noisy_ratio);
+    std::printf("frames per message: smooth %.1f, noisy %.1f (unpacked %u and %u)\n",
+                message_capacity / (smooth_ratio * 3 * sizeof(uint16_t)),
+                message_capacity / (noisy_ratio * 4 * sizeof(uint16_t)),
+                message_capacity / (3 * 2), message_capacity / (4 * 2));
+    CHECK(smooth_ratio < 0.6);
+    CHECK(noisy_ratio < 1.0);
+}
+
+int main()
+{
+    test_zigzag();
+    test_worst_case();
+    test_random();
+    benchmark_ratio();
+    return test_result();
+}
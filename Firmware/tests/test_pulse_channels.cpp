@@ -0,0 +1,146 @@
+#include <cstring>
+#include <pulse_channels.h>
+#include "test_common.h"
+
+// Trains whose last line was released, in the order they stopped.
+struct stop_log_t
+{
+    uint32_t train_ids[PULSE_LINE_COUNT];
+    uint32_t count;
+};
+
+// Releases the lines of the mask running a train, as stop_pulse_channel does.
+// Returns the lines stopped.
+uint8_t stop_lines(pulse_channel_t* channels, uint8_t output_mask, stop_log_t& log)
+{
+    uint8_t stopped_mask = 0;
+    for (uint32_t line = 0; line < PULSE_LINE_COUNT; line++)
+    {
+        if ((output_mask & (1u << line)) == 0 || !channels[line].active)
+            continue;
+        if (pulse_channel_release(channels, line))
+            log.train_ids[log.count++] = channels[line].train_id;
+        channels[line].pending = false;
+        stopped_mask |= 1u << line;
+    }
+    return stopped_mask;
+}
+
+// Assigns the lines of the mask to a new train, as start_pulse_train does.
+// Returns the lines taken over from other trains.
+uint8_t start_train(pulse_channel_t* channels, uint8_t output_mask, uint32_t train_id, stop_log_t& log)
+{
+    pulse_timing_t timing = {1, 10, 10, 0};
+    uint8_t stopped_mask = stop_lines(channels, output_mask, log);
+    for (uint32_t line = 0; line < PULSE_LINE_COUNT; line++)
+    {
+        if (output_mask & (1u << line))
+            pulse_channel_assign(channels[line], output_mask, train_id, 100, 10, 0, 1, timing, 0);
+    }
+    return stopped_mask;
+}
+
+bool line_runs(const pulse_channel_t* channels, uint32_t line, uint32_t train_id)
+{
+    return channels[line].active && channels[line].train_id == train_id;
+}
+
+// A train started on a busy line replaces the previous train on that line
+// only, and the previous train stops with the last of its other lines.
+void test_replace()
+{
+    pulse_channel_t channels[PULSE_LINE_COUNT];
+    std::memset(channels, 0, sizeof(channels));
+    stop_log_t log = {};
+
+    CHECK(start_train(channels, 0x03, 1, log) == 0);
+    CHECK(start_train(channels, 0x06, 2, log) == 0x02);
+    CHECK(log.count == 0);
+    CHECK(line_runs(channels, 0, 1));
+    CHECK(line_runs(channels, 1, 2));
+    CHECK(line_runs(channels, 2, 2));
+    CHECK(channels[1].pending && channels[1].train_mask == 0x06);
+
+    CHECK(start_train(channels, 0x01, 3, log) == 0x01);
+    CHECK(log.count == 1 && log.train_ids[0] == 1);
+    CHECK(line_runs(channels, 0, 3));
+    CHECK(line_runs(channels, 1, 2));
+
+    // Restarting a train on all its lines stops it once
+    CHECK(start_train(channels, 0x06, 4, log) == 0x06);
+    CHECK(log.count == 2 && log.train_ids[1] == 2);
+}
+
+// Stopping some lines of a train leaves its other lines and every other train
+// running, and the train stops with its last line.
+void test_stop()
+{
+    pulse_channel_t channels[PULSE_LINE_COUNT];
+    std::memset(channels, 0, sizeof(channels));
+    stop_log_t log = {};
+
+    start_train(channels, 0x0F, 1, log);
+    start_train(channels, 0x30, 2, log);
+    CHECK(stop_lines(channels, 0x05, log) == 0x05);
+    CHECK(log.count == 0);
+    CHECK(line_runs(channels, 1, 1) && line_runs(channels, 3, 1));
+    CHECK(line_runs(channels, 4, 2) && line_runs(channels, 5, 2));
+
+    // Idle lines in the mask are not reported as stopped
+    CHECK(stop_lines(channels, 0xCA, log) == 0x0A);
+    CHECK(log.count == 1 && log.train_ids[0] == 1);
+    CHECK(line_runs(channels, 4, 2) && line_runs(channels, 5, 2));
+    CHECK(stop_lines(channels, 0x0F, log) == 0);
+
+    CHECK(stop_lines(channels, 0xFF, log) == 0x30);
+    CHECK(log.count == 2 && log.train_ids[1] == 2);
+}
+
+// Trains started while every record is pending are not reported, and stopping
+// a train only finishes its own record.
+void test_report_records()
+{
+    pulse_report_t reports[PULSE_REPORT_CAPACITY];
+    std::memset(reports, 0, sizeof(reports));
+
+    for (uint32_t i = 0; i < PULSE_REPORT_CAPACITY; i++)
+    {
+        uint32_t record = pulse_report_find_free(reports);
+        CHECK(record == i);
+        reports[record].train_id = i + 1;
+        reports[record].active = true;
+    }
+    CHECK(pulse_report_find_free(reports) == PULSE_REPORT_CAPACITY);
+
+    pulse_report_stop(reports, 3, 1000, 42);
+    CHECK(reports[2].stopped && reports[2].stop_time_us == 1000 && reports[2].stop_count == 42);
+    CHECK(!reports[1].stopped && !reports[3].stopped);
+
+    // A stopped record keeps its stop time until it is reported
+    pulse_report_stop(reports, 3, 2000, 50);
+    CHECK(reports[2].stop_time_us == 1000);
+
+    pulse_report_stop(reports, 5, 1000, UINT64_MAX);
+    CHECK(reports[4].stop_count == PULSE_REPORT_NONE_PENDING - 1);
+
+    reports[7].active = false;
+    CHECK(pulse_report_find_free(reports) == 7);
+}
+
+// Channels and records are statically allocated, so their storage must stay
+// within its budget.
+void test_storage()
+{
+    uint32_t storage = sizeof(pulse_channel_t) * PULSE_LINE_COUNT + sizeof(pulse_report_t) * PULSE_REPORT_CAPACITY;
+    std::printf("pulse storage: %u of %u bytes\n", storage, PULSE_STORAGE_BUDGET);
+    CHECK(storage <= PULSE_STORAGE_BUDGET);
+}
+
+int main()
+{
+    test_replace();
+    test_stop();
+    test_report_records();
+    test_storage();
+    return test_result();
+}
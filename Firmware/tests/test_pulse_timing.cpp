@@ -0,0 +1,214 @@
+#include <deque>
+#include <vector>
+#include <pulse_timing.h>
+#include <pulse_report.h>
+#include "test_common.h"
+
+const uint32_t sys_clock_hz = 125000000;
+
+// Instructions of the pulse_train program, in the order of pulse_train.pio.
+enum pio_op_t { PULL, MOV_ISR_OSR, MOV_Y_OSR, PINS_HIGH, PINS_LOW, MOV_X_ISR, MOV_X_OSR, JMP_X_DEC, JMP_Y_DEC, IRQ };
+struct pio_instruction_t
+{
+    pio_op_t op;
+    uint32_t target;
+};
+const pio_instruction_t pulse_train_program[] = {
+    {PULL, 0}, {MOV_ISR_OSR, 0},
+    {PULL, 0}, {MOV_Y_OSR, 0}, {PULL, 0},
+    {PINS_HIGH, 0}, {MOV_X_ISR, 0}, {JMP_X_DEC, 7},
+    {PINS_LOW, 0}, {MOV_X_OSR, 0}, {JMP_X_DEC, 10}, {JMP_Y_DEC, 5},
+    {PULL, 0}, {IRQ, 0}, {MOV_X_OSR, 0}, {JMP_X_DEC, 15},
+};
+const uint32_t program_wrap_target = 2;
+const uint32_t program_wrap = 15;
+const uint32_t program_pulse = 5;
+const uint32_t program_low = 10;
+
+struct pulse_trace_t
+{
+    std::vector<uint64_t> rising;  // Cycles of every rising edge.
+    std::vector<uint64_t> falling; // Cycles of every falling edge.
+    std::vector<uint64_t> irq;     // Cycles of every end of burst interrupt.
+};
+
+// Runs the program one instruction per cycle on the words loaded by the
+// firmware, until it stalls on an empty FIFO or the cycle limit is reached.
+pulse_trace_t run_program(const pulse_timing_t& timing, uint32_t count, uint32_t bursts, uint64_t cycle_limit)
+{
+    std::deque<uint32_t> fifo = {timing.high_loops};
+    for (uint32_t i = 0; i < bursts; i++)
+        fifo.insert(fifo.end(), {count > 0 ? count - 1 : 0, timing.low_loops, timing.gap_loops});
+
+    // Infinite trains wrap from the low phase back to the next pulse
+    uint32_t wrap_target = count > 0 ? program_wrap_target : program_pulse;
+    uint32_t wrap = count > 0 ? program_wrap : program_low;
+    pulse_trace_t trace;
+    uint32_t pc = 0, x = 0, y = 0, isr = 0, osr = 0;
+    for (uint64_t cycle = 0; cycle < cycle_limit; cycle++)
+    {
+        const pio_instruction_t& instruction = pulse_train_program[pc];
+        uint32_t next = pc == wrap ? wrap_target : pc + 1;
+        switch (instruction.op)
+        {
+            case PULL:
+                if (fifo.empty())
+                    return trace;
+                osr = fifo.front();
+                fifo.pop_front();
+                break;
+            case MOV_ISR_OSR: isr = osr; break;
+            case MOV_Y_OSR: y = osr; break;
+            case PINS_HIGH: trace.rising.push_back(cycle); break;
+            case PINS_LOW: trace.falling.push_back(cycle); break;
+            case MOV_X_ISR: x = isr; break;
+            case MOV_X_OSR: x = osr; break;
+            case JMP_X_DEC: if (x-- != 0) next = instruction.target; break;
+            case JMP_Y_DEC: if (y-- != 0) next = instruction.target; break;
+            case IRQ: trace.irq.push_back(cycle); break;
+        }
+        pc = next;
+    }
+    return trace;
+}
+
+uint64_t us_to_system_cycles(uint64_t time_us)
+{
+    return time_us * sys_clock_hz / 1000000;
+}
+
+// Every edge of the program must fall exactly where the train specifies,
+// which checks the cycle overheads of every phase.
+void check_train(uint32_t width_us, uint32_t period_us, uint32_t count, uint32_t burst_period_us, uint32_t bursts)
+{
+    pulse_timing_t timing;
+    CHECK(pulse_compute_timing(sys_clock_hz, width_us, period_us, count, burst_period_us, timing));
+    uint64_t total = count > 0 ? pulse_total_count(count, bursts) : 50;
+    uint64_t duration_us = pulse_edge_offset_us(total, period_us, count, burst_period_us);
+    pulse_trace_t trace = run_program(timing, count, bursts, us_to_system_cycles(duration_us) / timing.clkdiv + 100);
+
+    CHECK(trace.rising.size() >= total);
+    CHECK(count == 0 || trace.rising.size() == total);
+    CHECK(trace.falling.size() == trace.rising.size() || (count == 0 && trace.falling.size() + 1 == trace.rising.size()));
+    CHECK(count == 0 || trace.irq.size() == bursts);
+    for (uint64_t i = 0; i < total && i < trace.falling.size(); i++)
+    {
+        uint64_t rising = (trace.rising[i] - trace.rising[0]) * timing.clkdiv;
+        uint64_t falling = (trace.falling[i] - trace.rising[0]) * timing.clkdiv;
+        uint64_t offset_us = pulse_edge_offset_us(i, period_us, count, burst_period_us);
+        CHECK(rising == us_to_system_cycles(offset_us));
+        CHECK(falling == us_to_system_cycles(offset_us + width_us));
+    }
+}
+
+void test_program_timing()
+{
+    check_train(100, 1000, 10, 0, 1);
+    check_train(1, 2, 100, 0, 1);
+    check_train(10, 100, 0, 0, 1);
+    check_train(50, 200, 5, 2000, 4);
+    check_train(50, 1900, 1, 2000, 10);
+}
+
+// Periods beyond 32 bits of system cycles need a clock divider.
+void test_clock_divider()
+{
+    pulse_timing_t timing;
+    CHECK(pulse_compute_timing(sys_clock_hz, 1000, 30000000, 1, 0, timing));
+    CHECK(timing.clkdiv == 1);
+    CHECK(pulse_compute_timing(sys_clock_hz, 1000, 60000000, 1, 0, timing));
+    CHECK(timing.clkdiv == 2);
+    CHECK(pulse_compute_timing(sys_clock_hz, 1000, 2000, 10, 60000000, timing));
+    CHECK(timing.clkdiv == 2);
+    check_train(1000000, 60000000, 2, 0, 1);
+}
+
+// Pulses must not overlap the next pulse, nor bursts the next burst, and
+// every phase must be long enough for the program overhead.
+void test_overlap()
+{
+    pulse_timing_t timing;
+    CHECK(!pulse_compute_timing(sys_clock_hz, 0, 1000, 1, 0, timing));
+    CHECK(!pulse_compute_timing(sys_clock_hz, 1000, 1000, 1, 0, timing));
+    CHECK(!pulse_compute_timing(sys_clock_hz, 1001, 1000, 1, 0, timing));
+    CHECK(!pulse_compute_timing(sys_clock_hz, 100, 1000, 10, 10000, timing));
+    CHECK(!pulse_compute_timing(sys_clock_hz, 100, 1000, 10, 9000, timing));
+    CHECK(pulse_compute_timing(sys_clock_hz, 100, 1000, 10, 10001, timing));
+    CHECK(!pulse_compute_timing(1000000, 1, 2, 1, 0, timing));
+}
+
+// Bursts must last long enough to load the burst after next, while single
+// bursts are not reloaded and have no limit.
+void test_reload_latency()
+{
+    pulse_timing_t timing;
+    CHECK(!pulse_compute_timing(sys_clock_hz, 10, 100, 1, PULSE_MIN_BURST_PERIOD_US - 1, timing));
+    CHECK(pulse_compute_timing(sys_clock_hz, 10, 100, 1, PULSE_MIN_BURST_PERIOD_US, timing));
+    CHECK(pulse_compute_timing(sys_clock_hz, 10, 100, 1, 0, timing));
+    CHECK(pulse_compute_timing(sys_clock_hz, 10, 100, 0, 0, timing));
+}
+
+// Edge counts follow the edge offsets, with each edge counted from the
+// microsecond it occurs.
+void test_edge_count()
+{
+    struct { uint32_t period_us, count, burst_period_us, burst_count; } trains[] = {
+        {100, 0, 0, 1}, {100, 7, 0, 1}, {100, 5, 1000, 4}, {100, 5, 1000, 0},
+    };
+    for (auto& train : trains)
+    {
+        uint64_t total = pulse_total_count(train.count, train.burst_count);
+        uint64_t limit = total > 0 ? total : 100;
+        for (uint64_t i = 0; i < limit; i++)
+        {
+            uint64_t offset_us = pulse_edge_offset_us(i, train.period_us, train.count, train.burst_period_us);
+            CHECK(pulse_edges_elapsed(offset_us, train.period_us, train.count, train.burst_period_us) >= i + 1);
+            if (offset_us > 0)
+                CHECK(pulse_edges_elapsed(offset_us - 1, train.period_us, train.count, train.burst_period_us) == i);
+            CHECK(pulse_report_edges(1000, train.period_us, train.count, train.burst_period_us, train.burst_count,
+                                     1000 + offset_us) == i + 1);
+        }
+        if (total > 0)
+            CHECK(pulse_report_edges(0, train.period_us, train.count, train.burst_period_us, train.burst_count,
+                                     UINT32_MAX) == total);
+    }
+    CHECK(pulse_report_edges(1000, 100, 0, 0, 1, 999) == 0);
+}
+
+// Stopped trains count the bursts completed by the program, plus the edges
+// of the burst cut short.
+void test_stop_count()
+{
+    CHECK(pulse_report_count(0, 100, 5, 1000, 4, 0) == 1);
+    CHECK(pulse_report_count(450, 100, 5, 1000, 4, 0) == 5);
+    CHECK(pulse_report_count(999, 100, 5, 1000, 4, 0) == 5);
+    CHECK(pulse_report_count(999, 100, 5, 1000, 4, 1) == 5);
+    CHECK(pulse_report_count(1000, 100, 5, 1000, 4, 1) == 6);
+    CHECK(pulse_report_count(1250, 100, 5, 1000, 4, 1) == 8);
+    CHECK(pulse_report_count(5000, 100, 5, 1000, 4, 4) == 20);
+    CHECK(pulse_report_count(650, 100, 7, 0, 1, 1) == 7);
+    CHECK(pulse_report_count(650, 100, 0, 0, 1, 0) == 7);
+}
+
+void test_report_policy()
+{
+    CHECK(pulse_report_next(PULSE_REPORT_START_STOP, 1, 0) == 0);
+    CHECK(pulse_report_next(PULSE_REPORT_START_STOP, 1, 1) == PULSE_REPORT_NONE_PENDING);
+    CHECK(pulse_report_next(PULSE_REPORT_EVERY_NTH, 10, 0) == 0);
+    CHECK(pulse_report_next(PULSE_REPORT_EVERY_NTH, 10, 1) == 10);
+    CHECK(pulse_report_next(PULSE_REPORT_EVERY_NTH, 10, 10) == 10);
+    CHECK(pulse_report_next(PULSE_REPORT_EVERY_PULSE, 1, 42) == 42);
+    CHECK(pulse_report_next(PULSE_REPORT_NONE, 1, 0) == PULSE_REPORT_NONE_PENDING);
+}
+
+int main()
+{
+    test_program_timing();
+    test_clock_divider();
+    test_overlap();
+    test_reload_latency();
+    test_edge_count();
+    test_stop_count();
+    test_report_policy();
+    return test_result();
+}
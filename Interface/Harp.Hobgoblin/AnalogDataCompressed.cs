@@ -0,0 +1,74 @@
+using System.Collections.Generic;
+using Bonsai.Harp;
+
+namespace Harp.Hobgoblin
+{
+    public partial class AnalogDataCompressed
+    {
+        /// <summary>
+        /// Decodes a batch of delta compressed analog frames.
+        /// </summary>
+        /// <param name="payload">The compressed payload data.</param>
+        /// <returns>An array containing the interleaved analog values of all decoded frames.</returns>
+        public static ushort[] Decode(byte[] payload)
+        {
+            var result = new List<ushort>(payload.Length);
+            int channelCount = payload.Length > 0 ? payload[0] : 0;
+            if (channelCount == 0)
+            {
+                return result.ToArray();
+            }
+
+            int offset = 1;
+            var previous = new ushort[channelCount];
+            for (int channel = 0; channel < channelCount && offset + 1 < payload.Length; channel++, offset += 2)
+            {
+                previous[channel] = (ushort)(payload[offset] | (payload[offset + 1] << 8));
+                result.Add(previous[channel]);
+            }
+
+            int index = 0;
+            while (offset < payload.Length)
+            {
+                uint value = 0;
+                int shift = 0;
+                byte next;
+                do
+                {
+                    next = payload[offset++];
+                    value |= (uint)(next & 0x7F) << shift;
+                    shift += 7;
+                }
+                while ((next & 0x80) != 0 && offset < payload.Length);
+
+                var delta = (int)(value >> 1) ^ -(int)(value & 1);
+                previous[index] = (ushort)(previous[index] + delta);
+                result.Add(previous[index]);
+                index = (index + 1) % channelCount;
+            }
+
+            return result.ToArray();
+        }
+
+        /// <summary>
+        /// Returns the decoded analog values for <see cref="AnalogDataCompressed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>An array of interleaved analog values of the enabled channels.</returns>
+        public static ushort[] GetDecodedPayload(HarpMessage message)
+        {
+            return Decode(GetPayload(message));
+        }
+
+        /// <summary>
+        /// Returns the timestamped decoded analog values for <see cref="AnalogDataCompressed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A timestamped array of interleaved analog values of the enabled channels.</returns>
+        public static Timestamped<ushort[]> GetTimestampedDecodedPayload(HarpMessage message)
+        {
+            var payload = GetTimestampedPayload(message);
+            return Timestamped.Create(Decode(payload.Value), payload.Seconds);
+        }
+    }
+}
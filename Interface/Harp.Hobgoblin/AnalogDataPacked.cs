@@ -0,0 +1,52 @@
+using Bonsai.Harp;
+
+namespace Harp.Hobgoblin
+{
+    public partial class AnalogDataPacked
+    {
+        /// <summary>
+        /// Unpacks an array of 12-bit values stored two in every three bytes.
+        /// </summary>
+        /// <param name="payload">The packed payload data.</param>
+        /// <returns>An array containing the unpacked 12-bit values.</returns>
+        public static ushort[] Unpack(byte[] payload)
+        {
+            var result = new ushort[payload.Length * 2 / 3];
+            int offset = 0;
+            int i = 0;
+            for (; i + 1 < result.Length; i += 2, offset += 3)
+            {
+                result[i] = (ushort)(payload[offset] | ((payload[offset + 1] & 0xF) << 8));
+                result[i + 1] = (ushort)((payload[offset + 1] >> 4) | (payload[offset + 2] << 4));
+            }
+
+            if (i < result.Length)
+            {
+                result[i] = (ushort)(payload[offset] | ((payload[offset + 1] & 0xF) << 8));
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the unpacked analog values for <see cref="AnalogDataPacked"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>An array of interleaved analog values of the enabled channels.</returns>
+        public static ushort[] GetUnpackedPayload(HarpMessage message)
+        {
+            return Unpack(GetPayload(message));
+        }
+
+        /// <summary>
+        /// Returns the timestamped unpacked analog values for <see cref="AnalogDataPacked"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A timestamped array of interleaved analog values of the enabled channels.</returns>
+        public static Timestamped<ushort[]> GetTimestampedUnpackedPayload(HarpMessage message)
+        {
+            var payload = GetTimestampedPayload(message);
+            return Timestamped.Create(Unpack(payload.Value), payload.Seconds);
+        }
+    }
+}
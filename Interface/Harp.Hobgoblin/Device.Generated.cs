@@ -44,7 +44,58 @@ namespace Harp.Hobgoblin
             { 36, typeof(DigitalOutputState) },
             { 37, typeof(StartPulseTrain) },
             { 38, typeof(StopPulseTrain) },
-            { 39, typeof(AnalogData) }
+            { 39, typeof(AnalogData) },
+            { 40, typeof(AnalogSampleRate) },
+            { 41, typeof(AnalogDataBatchSize) },
+            { 42, typeof(AnalogDataBatch) },
+            { 43, typeof(AnalogDecimation) },
+            { 44, typeof(AnalogFilterOrder) },
+            { 45, typeof(AnalogChannelEnable) },
+            { 46, typeof(AnalogOverrun) },
+            { 47, typeof(AnalogThresholdEnable) },
+            { 48, typeof(AnalogThreshold) },
+            { 49, typeof(AnalogHysteresis) },
+            { 50, typeof(AnalogThresholdCrossing) },
+            { 51, typeof(AnalogDataEnable) },
+            { 52, typeof(AnalogReflexAction) },
+            { 53, typeof(AnalogReflexOutput) },
+            { 54, typeof(AnalogReflexPulseTrain) },
+            { 55, typeof(AnalogCaptureTrigger) },
+            { 56, typeof(AnalogCaptureDigitalInput) },
+            { 57, typeof(AnalogCaptureWindow) },
+            { 58, typeof(AnalogCaptureData) },
+            { 59, typeof(AnalogStartDelay) },
+            { 60, typeof(AnalogStartLatency) },
+            { 61, typeof(AnalogStatisticsEnable) },
+            { 62, typeof(AnalogStatistics) },
+            { 63, typeof(AnalogCalibrationOffset) },
+            { 64, typeof(AnalogCalibrationGain) },
+            { 65, typeof(AnalogCalibrationCommand) },
+            { 66, typeof(AnalogBiquadSections) },
+            { 67, typeof(AnalogBiquadCoefficients) },
+            { 68, typeof(AnalogDataFormat) },
+            { 69, typeof(AnalogDataPacked) },
+            { 70, typeof(AnalogDataCompressed) },
+            { 71, typeof(AnalogResync) },
+            { 72, typeof(AnalogPulseSampleOutputs) },
+            { 73, typeof(AnalogPulseSampleDelay) },
+            { 74, typeof(AnalogPulseSample) },
+            { 75, typeof(AnalogEnvelopeMode) },
+            { 76, typeof(PulseTrainStartTime) },
+            { 77, typeof(OutputSequence) },
+            { 78, typeof(StartOutputSequence) },
+            { 79, typeof(StopOutputSequence) },
+            { 80, typeof(OutputSequenceState) },
+            { 81, typeof(PwmEnable) },
+            { 82, typeof(PwmFrequency) },
+            { 83, typeof(PwmDutyCycle) },
+            { 84, typeof(PulseTrainReportMode) },
+            { 85, typeof(PulseTrainReportInterval) },
+            { 86, typeof(PulseTrainPulse) },
+            { 87, typeof(PulseTrainSummary) },
+            { 88, typeof(PulseTrainBurst) },
+            { 89, typeof(PulseTrainReportOverrun) },
+            { 90, typeof(AnalogPulseSampleOverrun) }
         };
 
         /// <summary>
@@ -266,6 +317,57 @@ namespace Harp.Hobgoblin
     /// <seealso cref="StartPulseTrain"/>
     /// <seealso cref="StopPulseTrain"/>
     /// <seealso cref="AnalogData"/>
+    /// <seealso cref="AnalogSampleRate"/>
+    /// <seealso cref="AnalogDataBatchSize"/>
+    /// <seealso cref="AnalogDataBatch"/>
+    /// <seealso cref="AnalogDecimation"/>
+    /// <seealso cref="AnalogFilterOrder"/>
+    /// <seealso cref="AnalogChannelEnable"/>
+    /// <seealso cref="AnalogOverrun"/>
+    /// <seealso cref="AnalogThresholdEnable"/>
+    /// <seealso cref="AnalogThreshold"/>
+    /// <seealso cref="AnalogHysteresis"/>
+    /// <seealso cref="AnalogThresholdCrossing"/>
+    /// <seealso cref="AnalogDataEnable"/>
+    /// <seealso cref="AnalogReflexAction"/>
+    /// <seealso cref="AnalogReflexOutput"/>
+    /// <seealso cref="AnalogReflexPulseTrain"/>
+    /// <seealso cref="AnalogCaptureTrigger"/>
+    /// <seealso cref="AnalogCaptureDigitalInput"/>
+    /// <seealso cref="AnalogCaptureWindow"/>
+    /// <seealso cref="AnalogCaptureData"/>
+    /// <seealso cref="AnalogStartDelay"/>
+    /// <seealso cref="AnalogStartLatency"/>
+    /// <seealso cref="AnalogStatisticsEnable"/>
+    /// <seealso cref="AnalogStatistics"/>
+    /// <seealso cref="AnalogCalibrationOffset"/>
+    /// <seealso cref="AnalogCalibrationGain"/>
+    /// <seealso cref="AnalogCalibrationCommand"/>
+    /// <seealso cref="AnalogBiquadSections"/>
+    /// <seealso cref="AnalogBiquadCoefficients"/>
+    /// <seealso cref="AnalogDataFormat"/>
+    /// <seealso cref="AnalogDataPacked"/>
+    /// <seealso cref="AnalogDataCompressed"/>
+    /// <seealso cref="AnalogResync"/>
+    /// <seealso cref="AnalogPulseSampleOutputs"/>
+    /// <seealso cref="AnalogPulseSampleDelay"/>
+    /// <seealso cref="AnalogPulseSample"/>
+    /// <seealso cref="AnalogEnvelopeMode"/>
+    /// <seealso cref="PulseTrainStartTime"/>
+    /// <seealso cref="OutputSequence"/>
+    /// <seealso cref="StartOutputSequence"/>
+    /// <seealso cref="StopOutputSequence"/>
+    /// <seealso cref="OutputSequenceState"/>
+    /// <seealso cref="PwmEnable"/>
+    /// <seealso cref="PwmFrequency"/>
+    /// <seealso cref="PwmDutyCycle"/>
+    /// <seealso cref="PulseTrainReportMode"/>
+    /// <seealso cref="PulseTrainReportInterval"/>
+    /// <seealso cref="PulseTrainPulse"/>
+    /// <seealso cref="PulseTrainSummary"/>
+    /// <seealso cref="PulseTrainBurst"/>
+    /// <seealso cref="PulseTrainReportOverrun"/>
+    /// <seealso cref="AnalogPulseSampleOverrun"/>
     [XmlInclude(typeof(DigitalInputState))]
     [XmlInclude(typeof(DigitalOutputSet))]
     [XmlInclude(typeof(DigitalOutputClear))]
@@ -274,6 +376,57 @@ namespace Harp.Hobgoblin
     [XmlInclude(typeof(StartPulseTrain))]
     [XmlInclude(typeof(StopPulseTrain))]
     [XmlInclude(typeof(AnalogData))]
+    [XmlInclude(typeof(AnalogSampleRate))]
+    [XmlInclude(typeof(AnalogDataBatchSize))]
+    [XmlInclude(typeof(AnalogDataBatch))]
+    [XmlInclude(typeof(AnalogDecimation))]
+    [XmlInclude(typeof(AnalogFilterOrder))]
+    [XmlInclude(typeof(AnalogChannelEnable))]
+    [XmlInclude(typeof(AnalogOverrun))]
+    [XmlInclude(typeof(AnalogThresholdEnable))]
+    [XmlInclude(typeof(AnalogThreshold))]
+    [XmlInclude(typeof(AnalogHysteresis))]
+    [XmlInclude(typeof(AnalogThresholdCrossing))]
+    [XmlInclude(typeof(AnalogDataEnable))]
+    [XmlInclude(typeof(AnalogReflexAction))]
+    [XmlInclude(typeof(AnalogReflexOutput))]
+    [XmlInclude(typeof(AnalogReflexPulseTrain))]
+    [XmlInclude(typeof(AnalogCaptureTrigger))]
+    [XmlInclude(typeof(AnalogCaptureDigitalInput))]
+    [XmlInclude(typeof(AnalogCaptureWindow))]
+    [XmlInclude(typeof(AnalogCaptureData))]
+    [XmlInclude(typeof(AnalogStartDelay))]
+    [XmlInclude(typeof(AnalogStartLatency))]
+    [XmlInclude(typeof(AnalogStatisticsEnable))]
+    [XmlInclude(typeof(AnalogStatistics))]
+    [XmlInclude(typeof(AnalogCalibrationOffset))]
+    [XmlInclude(typeof(AnalogCalibrationGain))]
+    [XmlInclude(typeof(AnalogCalibrationCommand))]
+    [XmlInclude(typeof(AnalogBiquadSections))]
+    [XmlInclude(typeof(AnalogBiquadCoefficients))]
+    [XmlInclude(typeof(AnalogDataFormat))]
+    [XmlInclude(typeof(AnalogDataPacked))]
+    [XmlInclude(typeof(AnalogDataCompressed))]
+    [XmlInclude(typeof(AnalogResync))]
+    [XmlInclude(typeof(AnalogPulseSampleOutputs))]
+    [XmlInclude(typeof(AnalogPulseSampleDelay))]
+    [XmlInclude(typeof(AnalogPulseSample))]
+    [XmlInclude(typeof(AnalogEnvelopeMode))]
+    [XmlInclude(typeof(PulseTrainStartTime))]
+    [XmlInclude(typeof(OutputSequence))]
+    [XmlInclude(typeof(StartOutputSequence))]
+    [XmlInclude(typeof(StopOutputSequence))]
+    [XmlInclude(typeof(OutputSequenceState))]
+    [XmlInclude(typeof(PwmEnable))]
+    [XmlInclude(typeof(PwmFrequency))]
+    [XmlInclude(typeof(PwmDutyCycle))]
+    [XmlInclude(typeof(PulseTrainReportMode))]
+    [XmlInclude(typeof(PulseTrainReportInterval))]
+    [XmlInclude(typeof(PulseTrainPulse))]
+    [XmlInclude(typeof(PulseTrainSummary))]
+    [XmlInclude(typeof(PulseTrainBurst))]
+    [XmlInclude(typeof(PulseTrainReportOverrun))]
+    [XmlInclude(typeof(AnalogPulseSampleOverrun))]
     [Description("Filters register-specific messages reported by the Hobgoblin device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -303,6 +456,57 @@ namespace Harp.Hobgoblin
     /// <seealso cref="StartPulseTrain"/>
     /// <seealso cref="StopPulseTrain"/>
     /// <seealso cref="AnalogData"/>
+    /// <seealso cref="AnalogSampleRate"/>
+    /// <seealso cref="AnalogDataBatchSize"/>
+    /// <seealso cref="AnalogDataBatch"/>
+    /// <seealso cref="AnalogDecimation"/>
+    /// <seealso cref="AnalogFilterOrder"/>
+    /// <seealso cref="AnalogChannelEnable"/>
+    /// <seealso cref="AnalogOverrun"/>
+    /// <seealso cref="AnalogThresholdEnable"/>
+    /// <seealso cref="AnalogThreshold"/>
+    /// <seealso cref="AnalogHysteresis"/>
+    /// <seealso cref="AnalogThresholdCrossing"/>
+    /// <seealso cref="AnalogDataEnable"/>
+    /// <seealso cref="AnalogReflexAction"/>
+    /// <seealso cref="AnalogReflexOutput"/>
+    /// <seealso cref="AnalogReflexPulseTrain"/>
+    /// <seealso cref="AnalogCaptureTrigger"/>
+    /// <seealso cref="AnalogCaptureDigitalInput"/>
+    /// <seealso cref="AnalogCaptureWindow"/>
+    /// <seealso cref="AnalogCaptureData"/>
+    /// <seealso cref="AnalogStartDelay"/>
+    /// <seealso cref="AnalogStartLatency"/>
+    /// <seealso cref="AnalogStatisticsEnable"/>
+    /// <seealso cref="AnalogStatistics"/>
+    /// <seealso cref="AnalogCalibrationOffset"/>
+    /// <seealso cref="AnalogCalibrationGain"/>
+    /// <seealso cref="AnalogCalibrationCommand"/>
+    /// <seealso cref="AnalogBiquadSections"/>
+    /// <seealso cref="AnalogBiquadCoefficients"/>
+    /// <seealso cref="AnalogDataFormat"/>
+    /// <seealso cref="AnalogDataPacked"/>
+    /// <seealso cref="AnalogDataCompressed"/>
+    /// <seealso cref="AnalogResync"/>
+    /// <seealso cref="AnalogPulseSampleOutputs"/>
+    /// <seealso cref="AnalogPulseSampleDelay"/>
+    /// <seealso cref="AnalogPulseSample"/>
+    /// <seealso cref="AnalogEnvelopeMode"/>
+    /// <seealso cref="PulseTrainStartTime"/>
+    /// <seealso cref="OutputSequence"/>
+    /// <seealso cref="StartOutputSequence"/>
+    /// <seealso cref="StopOutputSequence"/>
+    /// <seealso cref="OutputSequenceState"/>
+    /// <seealso cref="PwmEnable"/>
+    /// <seealso cref="PwmFrequency"/>
+    /// <seealso cref="PwmDutyCycle"/>
+    /// <seealso cref="PulseTrainReportMode"/>
+    /// <seealso cref="PulseTrainReportInterval"/>
+    /// <seealso cref="PulseTrainPulse"/>
+    /// <seealso cref="PulseTrainSummary"/>
+    /// <seealso cref="PulseTrainBurst"/>
+    /// <seealso cref="PulseTrainReportOverrun"/>
+    /// <seealso cref="AnalogPulseSampleOverrun"/>
     [XmlInclude(typeof(DigitalInputState))]
     [XmlInclude(typeof(DigitalOutputSet))]
     [XmlInclude(typeof(DigitalOutputClear))]
@@ -311,6 +515,57 @@ namespace Harp.Hobgoblin
     [XmlInclude(typeof(StartPulseTrain))]
     [XmlInclude(typeof(StopPulseTrain))]
     [XmlInclude(typeof(AnalogData))]
+    [XmlInclude(typeof(AnalogSampleRate))]
+    [XmlInclude(typeof(AnalogDataBatchSize))]
+    [XmlInclude(typeof(AnalogDataBatch))]
+    [XmlInclude(typeof(AnalogDecimation))]
+    [XmlInclude(typeof(AnalogFilterOrder))]
+    [XmlInclude(typeof(AnalogChannelEnable))]
+    [XmlInclude(typeof(AnalogOverrun))]
+    [XmlInclude(typeof(AnalogThresholdEnable))]
+    [XmlInclude(typeof(AnalogThreshold))]
+    [XmlInclude(typeof(AnalogHysteresis))]
+    [XmlInclude(typeof(AnalogThresholdCrossing))]
+    [XmlInclude(typeof(AnalogDataEnable))]
+    [XmlInclude(typeof(AnalogReflexAction))]
+    [XmlInclude(typeof(AnalogReflexOutput))]
+    [XmlInclude(typeof(AnalogReflexPulseTrain))]
+    [XmlInclude(typeof(AnalogCaptureTrigger))]
+    [XmlInclude(typeof(AnalogCaptureDigitalInput))]
+    [XmlInclude(typeof(AnalogCaptureWindow))]
+    [XmlInclude(typeof(AnalogCaptureData))]
+    [XmlInclude(typeof(AnalogStartDelay))]
+    [XmlInclude(typeof(AnalogStartLatency))]
+    [XmlInclude(typeof(AnalogStatisticsEnable))]
+    [XmlInclude(typeof(AnalogStatistics))]
+    [XmlInclude(typeof(AnalogCalibrationOffset))]
+    [XmlInclude(typeof(AnalogCalibrationGain))]
+    [XmlInclude(typeof(AnalogCalibrationCommand))]
+    [XmlInclude(typeof(AnalogBiquadSections))]
+    [XmlInclude(typeof(AnalogBiquadCoefficients))]
+    [XmlInclude(typeof(AnalogDataFormat))]
+    [XmlInclude(typeof(AnalogDataPacked))]
+    [XmlInclude(typeof(AnalogDataCompressed))]
+    [XmlInclude(typeof(AnalogResync))]
+    [XmlInclude(typeof(AnalogPulseSampleOutputs))]
+    [XmlInclude(typeof(AnalogPulseSampleDelay))]
+    [XmlInclude(typeof(AnalogPulseSample))]
+    [XmlInclude(typeof(AnalogEnvelopeMode))]
+    [XmlInclude(typeof(PulseTrainStartTime))]
+    [XmlInclude(typeof(OutputSequence))]
+    [XmlInclude(typeof(StartOutputSequence))]
+    [XmlInclude(typeof(StopOutputSequence))]
+    [XmlInclude(typeof(OutputSequenceState))]
+    [XmlInclude(typeof(PwmEnable))]
+    [XmlInclude(typeof(PwmFrequency))]
+    [XmlInclude(typeof(PwmDutyCycle))]
+    [XmlInclude(typeof(PulseTrainReportMode))]
+    [XmlInclude(typeof(PulseTrainReportInterval))]
+    [XmlInclude(typeof(PulseTrainPulse))]
+    [XmlInclude(typeof(PulseTrainSummary))]
+    [XmlInclude(typeof(PulseTrainBurst))]
+    [XmlInclude(typeof(PulseTrainReportOverrun))]
+    [XmlInclude(typeof(AnalogPulseSampleOverrun))]
     [XmlInclude(typeof(TimestampedDigitalInputState))]
     [XmlInclude(typeof(TimestampedDigitalOutputSet))]
     [XmlInclude(typeof(TimestampedDigitalOutputClear))]
@@ -319,6 +574,57 @@ namespace Harp.Hobgoblin
     [XmlInclude(typeof(TimestampedStartPulseTrain))]
     [XmlInclude(typeof(TimestampedStopPulseTrain))]
     [XmlInclude(typeof(TimestampedAnalogData))]
+    [XmlInclude(typeof(TimestampedAnalogSampleRate))]
+    [XmlInclude(typeof(TimestampedAnalogDataBatchSize))]
+    [XmlInclude(typeof(TimestampedAnalogDataBatch))]
+    [XmlInclude(typeof(TimestampedAnalogDecimation))]
+    [XmlInclude(typeof(TimestampedAnalogFilterOrder))]
+    [XmlInclude(typeof(TimestampedAnalogChannelEnable))]
+    [XmlInclude(typeof(TimestampedAnalogOverrun))]
+    [XmlInclude(typeof(TimestampedAnalogThresholdEnable))]
+    [XmlInclude(typeof(TimestampedAnalogThreshold))]
+    [XmlInclude(typeof(TimestampedAnalogHysteresis))]
+    [XmlInclude(typeof(TimestampedAnalogThresholdCrossing))]
+    [XmlInclude(typeof(TimestampedAnalogDataEnable))]
+    [XmlInclude(typeof(TimestampedAnalogReflexAction))]
+    [XmlInclude(typeof(TimestampedAnalogReflexOutput))]
+    [XmlInclude(typeof(TimestampedAnalogReflexPulseTrain))]
+    [XmlInclude(typeof(TimestampedAnalogCaptureTrigger))]
+    [XmlInclude(typeof(TimestampedAnalogCaptureDigitalInput))]
+    [XmlInclude(typeof(TimestampedAnalogCaptureWindow))]
+    [XmlInclude(typeof(TimestampedAnalogCaptureData))]
+    [XmlInclude(typeof(TimestampedAnalogStartDelay))]
+    [XmlInclude(typeof(TimestampedAnalogStartLatency))]
+    [XmlInclude(typeof(TimestampedAnalogStatisticsEnable))]
+    [XmlInclude(typeof(TimestampedAnalogStatistics))]
+    [XmlInclude(typeof(TimestampedAnalogCalibrationOffset))]
+    [XmlInclude(typeof(TimestampedAnalogCalibrationGain))]
+    [XmlInclude(typeof(TimestampedAnalogCalibrationCommand))]
+    [XmlInclude(typeof(TimestampedAnalogBiquadSections))]
+    [XmlInclude(typeof(TimestampedAnalogBiquadCoefficients))]
+    [XmlInclude(typeof(TimestampedAnalogDataFormat))]
+    [XmlInclude(typeof(TimestampedAnalogDataPacked))]
+    [XmlInclude(typeof(TimestampedAnalogDataCompressed))]
+    [XmlInclude(typeof(TimestampedAnalogResync))]
+    [XmlInclude(typeof(TimestampedAnalogPulseSampleOutputs))]
+    [XmlInclude(typeof(TimestampedAnalogPulseSampleDelay))]
+    [XmlInclude(typeof(TimestampedAnalogPulseSample))]
+    [XmlInclude(typeof(TimestampedAnalogEnvelopeMode))]
+    [XmlInclude(typeof(TimestampedPulseTrainStartTime))]
+    [XmlInclude(typeof(TimestampedOutputSequence))]
+    [XmlInclude(typeof(TimestampedStartOutputSequence))]
+    [XmlInclude(typeof(TimestampedStopOutputSequence))]
+    [XmlInclude(typeof(TimestampedOutputSequenceState))]
+    [XmlInclude(typeof(TimestampedPwmEnable))]
+    [XmlInclude(typeof(TimestampedPwmFrequency))]
+    [XmlInclude(typeof(TimestampedPwmDutyCycle))]
+    [XmlInclude(typeof(TimestampedPulseTrainReportMode))]
+    [XmlInclude(typeof(TimestampedPulseTrainReportInterval))]
+    [XmlInclude(typeof(TimestampedPulseTrainPulse))]
+    [XmlInclude(typeof(TimestampedPulseTrainSummary))]
+    [XmlInclude(typeof(TimestampedPulseTrainBurst))]
+    [XmlInclude(typeof(TimestampedPulseTrainReportOverrun))]
+    [XmlInclude(typeof(TimestampedAnalogPulseSampleOverrun))]
     [Description("Filters and selects specific messages reported by the Hobgoblin device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -345,6 +651,57 @@ namespace Harp.Hobgoblin
     /// <seealso cref="StartPulseTrain"/>
     /// <seealso cref="StopPulseTrain"/>
     /// <seealso cref="AnalogData"/>
+    /// <seealso cref="AnalogSampleRate"/>
+    /// <seealso cref="AnalogDataBatchSize"/>
+    /// <seealso cref="AnalogDataBatch"/>
+    /// <seealso cref="AnalogDecimation"/>
+    /// <seealso cref="AnalogFilterOrder"/>
+    /// <seealso cref="AnalogChannelEnable"/>
+    /// <seealso cref="AnalogOverrun"/>
+    /// <seealso cref="AnalogThresholdEnable"/>
+    /// <seealso cref="AnalogThreshold"/>
+    /// <seealso cref="AnalogHysteresis"/>
+    /// <seealso cref="AnalogThresholdCrossing"/>
+    /// <seealso cref="AnalogDataEnable"/>
+    /// <seealso cref="AnalogReflexAction"/>
+    /// <seealso cref="AnalogReflexOutput"/>
+    /// <seealso cref="AnalogReflexPulseTrain"/>
+    /// <seealso cref="AnalogCaptureTrigger"/>
+    /// <seealso cref="AnalogCaptureDigitalInput"/>
+    /// <seealso cref="AnalogCaptureWindow"/>
+    /// <seealso cref="AnalogCaptureData"/>
+    /// <seealso cref="AnalogStartDelay"/>
+    /// <seealso cref="AnalogStartLatency"/>
+    /// <seealso cref="AnalogStatisticsEnable"/>
+    /// <seealso cref="AnalogStatistics"/>
+    /// <seealso cref="AnalogCalibrationOffset"/>
+    /// <seealso cref="AnalogCalibrationGain"/>
+    /// <seealso cref="AnalogCalibrationCommand"/>
+    /// <seealso cref="AnalogBiquadSections"/>
+    /// <seealso cref="AnalogBiquadCoefficients"/>
+    /// <seealso cref="AnalogDataFormat"/>
+    /// <seealso cref="AnalogDataPacked"/>
+    /// <seealso cref="AnalogDataCompressed"/>
+    /// <seealso cref="AnalogResync"/>
+    /// <seealso cref="AnalogPulseSampleOutputs"/>
+    /// <seealso cref="AnalogPulseSampleDelay"/>
+    /// <seealso cref="AnalogPulseSample"/>
+    /// <seealso cref="AnalogEnvelopeMode"/>
+    /// <seealso cref="PulseTrainStartTime"/>
+    /// <seealso cref="OutputSequence"/>
+    /// <seealso cref="StartOutputSequence"/>
+    /// <seealso cref="StopOutputSequence"/>
+    /// <seealso cref="OutputSequenceState"/>
+    /// <seealso cref="PwmEnable"/>
+    /// <seealso cref="PwmFrequency"/>
+    /// <seealso cref="PwmDutyCycle"/>
+    /// <seealso cref="PulseTrainReportMode"/>
+    /// <seealso cref="PulseTrainReportInterval"/>
+    /// <seealso cref="PulseTrainPulse"/>
+    /// <seealso cref="PulseTrainSummary"/>
+    /// <seealso cref="PulseTrainBurst"/>
+    /// <seealso cref="PulseTrainReportOverrun"/>
+    /// <seealso cref="AnalogPulseSampleOverrun"/>
     [XmlInclude(typeof(DigitalInputState))]
     [XmlInclude(typeof(DigitalOutputSet))]
     [XmlInclude(typeof(DigitalOutputClear))]
@@ -353,6 +710,57 @@ namespace Harp.Hobgoblin
     [XmlInclude(typeof(StartPulseTrain))]
     [XmlInclude(typeof(StopPulseTrain))]
     [XmlInclude(typeof(AnalogData))]
+    [XmlInclude(typeof(AnalogSampleRate))]
+    [XmlInclude(typeof(AnalogDataBatchSize))]
+    [XmlInclude(typeof(AnalogDataBatch))]
+    [XmlInclude(typeof(AnalogDecimation))]
+    [XmlInclude(typeof(AnalogFilterOrder))]
+    [XmlInclude(typeof(AnalogChannelEnable))]
+    [XmlInclude(typeof(AnalogOverrun))]
+    [XmlInclude(typeof(AnalogThresholdEnable))]
+    [XmlInclude(typeof(AnalogThreshold))]
+    [XmlInclude(typeof(AnalogHysteresis))]
+    [XmlInclude(typeof(AnalogThresholdCrossing))]
+    [XmlInclude(typeof(AnalogDataEnable))]
+    [XmlInclude(typeof(AnalogReflexAction))]
+    [XmlInclude(typeof(AnalogReflexOutput))]
+    [XmlInclude(typeof(AnalogReflexPulseTrain))]
+    [XmlInclude(typeof(AnalogCaptureTrigger))]
+    [XmlInclude(typeof(AnalogCaptureDigitalInput))]
+    [XmlInclude(typeof(AnalogCaptureWindow))]
+    [XmlInclude(typeof(AnalogCaptureData))]
+    [XmlInclude(typeof(AnalogStartDelay))]
+    [XmlInclude(typeof(AnalogStartLatency))]
+    [XmlInclude(typeof(AnalogStatisticsEnable))]
+    [XmlInclude(typeof(AnalogStatistics))]
+    [XmlInclude(typeof(AnalogCalibrationOffset))]
+    [XmlInclude(typeof(AnalogCalibrationGain))]
+    [XmlInclude(typeof(AnalogCalibrationCommand))]
+    [XmlInclude(typeof(AnalogBiquadSections))]
+    [XmlInclude(typeof(AnalogBiquadCoefficients))]
+    [XmlInclude(typeof(AnalogDataFormat))]
+    [XmlInclude(typeof(AnalogDataPacked))]
+    [XmlInclude(typeof(AnalogDataCompressed))]
+    [XmlInclude(typeof(AnalogResync))]
+    [XmlInclude(typeof(AnalogPulseSampleOutputs))]
+    [XmlInclude(typeof(AnalogPulseSampleDelay))]
+    [XmlInclude(typeof(AnalogPulseSample))]
+    [XmlInclude(typeof(AnalogEnvelopeMode))]
+    [XmlInclude(typeof(PulseTrainStartTime))]
+    [XmlInclude(typeof(OutputSequence))]
+    [XmlInclude(typeof(StartOutputSequence))]
+    [XmlInclude(typeof(StopOutputSequence))]
+    [XmlInclude(typeof(OutputSequenceState))]
+    [XmlInclude(typeof(PwmEnable))]
+    [XmlInclude(typeof(PwmFrequency))]
+    [XmlInclude(typeof(PwmDutyCycle))]
+    [XmlInclude(typeof(PulseTrainReportMode))]
+    [XmlInclude(typeof(PulseTrainReportInterval))]
+    [XmlInclude(typeof(PulseTrainPulse))]
+    [XmlInclude(typeof(PulseTrainSummary))]
+    [XmlInclude(typeof(PulseTrainBurst))]
+    [XmlInclude(typeof(PulseTrainReportOverrun))]
+    [XmlInclude(typeof(AnalogPulseSampleOverrun))]
     [Description("Formats a sequence of values as specific Hobgoblin register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -853,9 +1261,9 @@ namespace Harp.Hobgoblin
     }
 
     /// <summary>
-    /// Represents a register that starts a pulse train driving the specified digital output lines.
+    /// Represents a register that starts a pulse train driving the specified digital output lines. Pulses are generated by a PIO state machine with sub-microsecond edge timing and no per-pulse events. Each line runs independently, and a new train replaces any train running on its lines, which are reported in StopPulseTrain. Lines 0-3 and lines 4-7 run on separate PIO blocks, so edges are aligned within each group but a train spanning both starts lines 4-7 a few system clock cycles after lines 0-3, under 100 ns. The pulse width must be shorter than the period. Finite trains are repeated in bursts as specified by PulseTrainBurst.
     /// </summary>
-    [Description("Starts a pulse train driving the specified digital output lines.")]
+    [Description("Starts a pulse train driving the specified digital output lines. Pulses are generated by a PIO state machine with sub-microsecond edge timing and no per-pulse events. Each line runs independently, and a new train replaces any train running on its lines, which are reported in StopPulseTrain. Lines 0-3 and lines 4-7 run on separate PIO blocks, so edges are aligned within each group but a train spanning both starts lines 4-7 a few system clock cycles after lines 0-3, under 100 ns. The pulse width must be shorter than the period. Finite trains are repeated in bursts as specified by PulseTrainBurst.")]
     public partial class StartPulseTrain
     {
         /// <summary>
@@ -971,9 +1379,9 @@ namespace Harp.Hobgoblin
     }
 
     /// <summary>
-    /// Represents a register that stops the pulse train running on the specified digital output lines.
+    /// Represents a register that stops the pulse train running on the specified digital output lines. Lines of the same train which are not specified keep running. Reports the lines of trains which complete or are replaced.
     /// </summary>
-    [Description("Stops the pulse train running on the specified digital output lines.")]
+    [Description("Stops the pulse train running on the specified digital output lines. Lines of the same train which are not specified keep running. Reports the lines of trains which complete or are replaced.")]
     public partial class StopPulseTrain
     {
         /// <summary>
@@ -1068,9 +1476,9 @@ namespace Harp.Hobgoblin
     }
 
     /// <summary>
-    /// Represents a register that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution.
+    /// Represents a register that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution. Channels disabled in AnalogChannelEnable report zero. When the temperature sensor is enabled, its value follows as a fourth value, filtered and calibrated like the analog inputs.
     /// </summary>
-    [Description("Reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution.")]
+    [Description("Reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution. Channels disabled in AnalogChannelEnable report zero. When the temperature sensor is enabled, its value follows as a fourth value, filtered and calibrated like the analog inputs.")]
     public partial class AnalogData
     {
         /// <summary>
@@ -1184,631 +1592,10175 @@ namespace Harp.Hobgoblin
     }
 
     /// <summary>
-    /// Represents an operator which creates standard message payloads for the
-    /// Hobgoblin device.
+    /// Represents a register that specifies the rate, in Hz, at which analog frames are sampled and reported. The ADC clock is paced so every conversion is filtered into a reported frame.
     /// </summary>
-    /// <seealso cref="CreateDigitalInputStatePayload"/>
-    /// <seealso cref="CreateDigitalOutputSetPayload"/>
-    /// <seealso cref="CreateDigitalOutputClearPayload"/>
-    /// <seealso cref="CreateDigitalOutputTogglePayload"/>
-    /// <seealso cref="CreateDigitalOutputStatePayload"/>
-    /// <seealso cref="CreateStartPulseTrainPayload"/>
-    /// <seealso cref="CreateStopPulseTrainPayload"/>
-    /// <seealso cref="CreateAnalogDataPayload"/>
-    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateDigitalOutputSetPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputClearPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputTogglePayload))]
-    [XmlInclude(typeof(CreateDigitalOutputStatePayload))]
-    [XmlInclude(typeof(CreateStartPulseTrainPayload))]
-    [XmlInclude(typeof(CreateStopPulseTrainPayload))]
-    [XmlInclude(typeof(CreateAnalogDataPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputSetPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputClearPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputTogglePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedStartPulseTrainPayload))]
-    [XmlInclude(typeof(CreateTimestampedStopPulseTrainPayload))]
-    [XmlInclude(typeof(CreateTimestampedAnalogDataPayload))]
-    [Description("Creates standard message payloads for the Hobgoblin device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    [Description("Specifies the rate, in Hz, at which analog frames are sampled and reported. The ADC clock is paced so every conversion is filtered into a reported frame.")]
+    public partial class AnalogSampleRate
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Represents the address of the <see cref="AnalogSampleRate"/> register. This field is constant.
         /// </summary>
-        public CreateMessage()
-        {
-            Payload = new CreateDigitalInputStatePayload();
-        }
-
-        string INamedElement.Name => $"{nameof(Hobgoblin)}.{GetElementDisplayName(Payload)}";
-    }
+        public const int Address = 40;
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that reflects the state of the digital input lines.
-    /// </summary>
-    [DisplayName("DigitalInputStatePayload")]
-    [Description("Creates a message payload that reflects the state of the digital input lines.")]
-    public partial class CreateDigitalInputStatePayload
-    {
         /// <summary>
-        /// Gets or sets the value that reflects the state of the digital input lines.
+        /// Represents the payload type of the <see cref="AnalogSampleRate"/> register. This field is constant.
         /// </summary>
-        [Description("The value that reflects the state of the digital input lines.")]
-        public DigitalInputs DigitalInputState { get; set; }
+        public const PayloadType RegisterType = PayloadType.U32;
 
         /// <summary>
-        /// Creates a message payload for the DigitalInputState register.
+        /// Represents the length of the <see cref="AnalogSampleRate"/> register. This field is constant.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public DigitalInputs GetPayload()
-        {
-            return DigitalInputState;
-        }
+        public const int RegisterLength = 1;
 
         /// <summary>
-        /// Creates a message that reflects the state of the digital input lines.
+        /// Returns the payload data for <see cref="AnalogSampleRate"/> register messages.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalInputState register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
         {
-            return Harp.Hobgoblin.DigitalInputState.FromPayload(messageType, GetPayload());
+            return message.GetPayloadUInt32();
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that reflects the state of the digital input lines.
-    /// </summary>
-    [DisplayName("TimestampedDigitalInputStatePayload")]
-    [Description("Creates a timestamped message payload that reflects the state of the digital input lines.")]
-    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
-    {
         /// <summary>
-        /// Creates a timestamped message that reflects the state of the digital input lines.
+        /// Returns the timestamped payload data for <see cref="AnalogSampleRate"/> register messages.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
         {
-            return Harp.Hobgoblin.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+            return message.GetTimestampedPayloadUInt32();
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that sets the specified digital output lines.
-    /// </summary>
-    [DisplayName("DigitalOutputSetPayload")]
-    [Description("Creates a message payload that sets the specified digital output lines.")]
-    public partial class CreateDigitalOutputSetPayload
-    {
         /// <summary>
-        /// Gets or sets the value that sets the specified digital output lines.
-        /// </summary>
-        [Description("The value that sets the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputSet { get; set; }
-
-        /// <summary>
-        /// Creates a message payload for the DigitalOutputSet register.
+        /// Returns a Harp message for the <see cref="AnalogSampleRate"/> register.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogSampleRate"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
         {
-            return DigitalOutputSet;
+            return HarpMessage.FromUInt32(Address, messageType, value);
         }
 
         /// <summary>
-        /// Creates a message that sets the specified digital output lines.
+        /// Returns a timestamped Harp message for the <see cref="AnalogSampleRate"/>
+        /// register.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputSet register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogSampleRate"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
         {
-            return Harp.Hobgoblin.DigitalOutputSet.FromPayload(messageType, GetPayload());
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that sets the specified digital output lines.
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogSampleRate register.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputSetPayload")]
-    [Description("Creates a timestamped message payload that sets the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputSetPayload : CreateDigitalOutputSetPayload
+    /// <seealso cref="AnalogSampleRate"/>
+    [Description("Filters and selects timestamped messages from the AnalogSampleRate register.")]
+    public partial class TimestampedAnalogSampleRate
     {
         /// <summary>
-        /// Creates a timestamped message that sets the specified digital output lines.
+        /// Represents the address of the <see cref="AnalogSampleRate"/> register. This field is constant.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputSet register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        public const int Address = AnalogSampleRate.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogSampleRate"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
         {
-            return Harp.Hobgoblin.DigitalOutputSet.FromPayload(timestamp, messageType, GetPayload());
+            return AnalogSampleRate.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that clears the specified digital output lines.
+    /// Represents a register that specifies the number of consecutive analog frames reported in each AnalogDataBatch event. A value of zero reports each frame individually in the AnalogData register. Each batch can hold at most 120 values across all enabled channels.
     /// </summary>
-    [DisplayName("DigitalOutputClearPayload")]
-    [Description("Creates a message payload that clears the specified digital output lines.")]
-    public partial class CreateDigitalOutputClearPayload
+    [Description("Specifies the number of consecutive analog frames reported in each AnalogDataBatch event. A value of zero reports each frame individually in the AnalogData register. Each batch can hold at most 120 values across all enabled channels.")]
+    public partial class AnalogDataBatchSize
     {
         /// <summary>
-        /// Gets or sets the value that clears the specified digital output lines.
+        /// Represents the address of the <see cref="AnalogDataBatchSize"/> register. This field is constant.
         /// </summary>
-        [Description("The value that clears the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputClear { get; set; }
+        public const int Address = 41;
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputClear register.
+        /// Represents the payload type of the <see cref="AnalogDataBatchSize"/> register. This field is constant.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
-        {
-            return DigitalOutputClear;
-        }
+        public const PayloadType RegisterType = PayloadType.U8;
 
         /// <summary>
-        /// Creates a message that clears the specified digital output lines.
+        /// Represents the length of the <see cref="AnalogDataBatchSize"/> register. This field is constant.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputClear register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.Hobgoblin.DigitalOutputClear.FromPayload(messageType, GetPayload());
-        }
-    }
+        public const int RegisterLength = 1;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that clears the specified digital output lines.
-    /// </summary>
-    [DisplayName("TimestampedDigitalOutputClearPayload")]
-    [Description("Creates a timestamped message payload that clears the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputClearPayload : CreateDigitalOutputClearPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that clears the specified digital output lines.
+        /// Returns the payload data for <see cref="AnalogDataBatchSize"/> register messages.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputClear register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
         {
-            return Harp.Hobgoblin.DigitalOutputClear.FromPayload(timestamp, messageType, GetPayload());
+            return message.GetPayloadByte();
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that toggles the specified digital output lines.
-    /// </summary>
-    [DisplayName("DigitalOutputTogglePayload")]
-    [Description("Creates a message payload that toggles the specified digital output lines.")]
-    public partial class CreateDigitalOutputTogglePayload
-    {
         /// <summary>
-        /// Gets or sets the value that toggles the specified digital output lines.
+        /// Returns the timestamped payload data for <see cref="AnalogDataBatchSize"/> register messages.
         /// </summary>
-        [Description("The value that toggles the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputToggle { get; set; }
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputToggle register.
+        /// Returns a Harp message for the <see cref="AnalogDataBatchSize"/> register.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataBatchSize"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
         {
-            return DigitalOutputToggle;
+            return HarpMessage.FromByte(Address, messageType, value);
         }
 
         /// <summary>
-        /// Creates a message that toggles the specified digital output lines.
+        /// Returns a timestamped Harp message for the <see cref="AnalogDataBatchSize"/>
+        /// register.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputToggle register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataBatchSize"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
         {
-            return Harp.Hobgoblin.DigitalOutputToggle.FromPayload(messageType, GetPayload());
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that toggles the specified digital output lines.
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogDataBatchSize register.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputTogglePayload")]
-    [Description("Creates a timestamped message payload that toggles the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputTogglePayload : CreateDigitalOutputTogglePayload
+    /// <seealso cref="AnalogDataBatchSize"/>
+    [Description("Filters and selects timestamped messages from the AnalogDataBatchSize register.")]
+    public partial class TimestampedAnalogDataBatchSize
     {
         /// <summary>
-        /// Creates a timestamped message that toggles the specified digital output lines.
+        /// Represents the address of the <see cref="AnalogDataBatchSize"/> register. This field is constant.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputToggle register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        public const int Address = AnalogDataBatchSize.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogDataBatchSize"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
         {
-            return Harp.Hobgoblin.DigitalOutputToggle.FromPayload(timestamp, messageType, GetPayload());
+            return AnalogDataBatchSize.GetTimestampedPayload(message);
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that writes the state of all digital output lines.
+    /// Represents a register that reports a batch of consecutive analog frames with interleaved values of the enabled channels, in ascending channel order. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
     /// </summary>
-    [DisplayName("DigitalOutputStatePayload")]
-    [Description("Creates a message payload that writes the state of all digital output lines.")]
-    public partial class CreateDigitalOutputStatePayload
+    [Description("Reports a batch of consecutive analog frames with interleaved values of the enabled channels, in ascending channel order. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.")]
+    public partial class AnalogDataBatch
     {
         /// <summary>
-        /// Gets or sets the value that writes the state of all digital output lines.
+        /// Represents the address of the <see cref="AnalogDataBatch"/> register. This field is constant.
         /// </summary>
-        [Description("The value that writes the state of all digital output lines.")]
-        public DigitalOutputs DigitalOutputState { get; set; }
+        public const int Address = 42;
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputState register.
+        /// Represents the payload type of the <see cref="AnalogDataBatch"/> register. This field is constant.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 120;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
         {
-            return DigitalOutputState;
+            return message.GetPayloadArray<ushort>();
         }
 
         /// <summary>
-        /// Creates a message that writes the state of all digital output lines.
+        /// Returns the timestamped payload data for <see cref="AnalogDataBatch"/> register messages.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputState register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
         {
-            return Harp.Hobgoblin.DigitalOutputState.FromPayload(messageType, GetPayload());
+            return message.GetTimestampedPayloadArray<ushort>();
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that writes the state of all digital output lines.
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogDataBatch"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataBatch"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogDataBatch"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataBatch"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogDataBatch register.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputStatePayload")]
-    [Description("Creates a timestamped message payload that writes the state of all digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputStatePayload : CreateDigitalOutputStatePayload
+    /// <seealso cref="AnalogDataBatch"/>
+    [Description("Filters and selects timestamped messages from the AnalogDataBatch register.")]
+    public partial class TimestampedAnalogDataBatch
     {
         /// <summary>
-        /// Creates a timestamped message that writes the state of all digital output lines.
+        /// Represents the address of the <see cref="AnalogDataBatch"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogDataBatch.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogDataBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return AnalogDataBatch.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the minimum number of scans of all analog channels decimated into each reported frame. The ADC conversion rate is increased accordingly.
+    /// </summary>
+    [Description("Specifies the minimum number of scans of all analog channels decimated into each reported frame. The ADC conversion rate is increased accordingly.")]
+    public partial class AnalogDecimation
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDecimation"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 43;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogDecimation"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogDecimation"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogDecimation"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogDecimation"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogDecimation"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDecimation"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogDecimation"/>
+        /// register.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputState register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDecimation"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogDecimation register.
+    /// </summary>
+    /// <seealso cref="AnalogDecimation"/>
+    [Description("Filters and selects timestamped messages from the AnalogDecimation register.")]
+    public partial class TimestampedAnalogDecimation
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDecimation"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogDecimation.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogDecimation"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return AnalogDecimation.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the order of the CIC decimation filter applied to each analog channel. A value of one is a boxcar average over each frame.
+    /// </summary>
+    [Description("Specifies the order of the CIC decimation filter applied to each analog channel. A value of one is a boxcar average over each frame.")]
+    public partial class AnalogFilterOrder
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogFilterOrder"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 44;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogFilterOrder"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogFilterOrder"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogFilterOrder"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogFilterOrder"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogFilterOrder"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogFilterOrder"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogFilterOrder"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogFilterOrder"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogFilterOrder register.
+    /// </summary>
+    /// <seealso cref="AnalogFilterOrder"/>
+    [Description("Filters and selects timestamped messages from the AnalogFilterOrder register.")]
+    public partial class TimestampedAnalogFilterOrder
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogFilterOrder"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogFilterOrder.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogFilterOrder"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return AnalogFilterOrder.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies which analog channels are sampled. The ADC conversion rate is shared between all enabled channels. The internal temperature sensor is sampled, filtered and calibrated like the analog inputs when Temperature is enabled. By default all three analog inputs are enabled.
+    /// </summary>
+    [Description("Specifies which analog channels are sampled. The ADC conversion rate is shared between all enabled channels. The internal temperature sensor is sampled, filtered and calibrated like the analog inputs when Temperature is enabled. By default all three analog inputs are enabled.")]
+    public partial class AnalogChannelEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogChannelEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 45;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogChannelEnable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogChannelEnable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogChannelEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogChannels GetPayload(HarpMessage message)
+        {
+            return (AnalogChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogChannelEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((AnalogChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogChannelEnable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogChannelEnable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogChannelEnable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogChannelEnable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogChannelEnable register.
+    /// </summary>
+    /// <seealso cref="AnalogChannelEnable"/>
+    [Description("Filters and selects timestamped messages from the AnalogChannelEnable register.")]
+    public partial class TimestampedAnalogChannelEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogChannelEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogChannelEnable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogChannelEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogChannels> GetPayload(HarpMessage message)
+        {
+            return AnalogChannelEnable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the number of analog frames dropped because the device could not send them to the host in time.
+    /// </summary>
+    [Description("Reports the number of analog frames dropped because the device could not send them to the host in time.")]
+    public partial class AnalogOverrun
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogOverrun"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 46;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogOverrun"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogOverrun"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogOverrun"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogOverrun"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogOverrun"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogOverrun"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogOverrun"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogOverrun"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogOverrun register.
+    /// </summary>
+    /// <seealso cref="AnalogOverrun"/>
+    [Description("Filters and selects timestamped messages from the AnalogOverrun register.")]
+    public partial class TimestampedAnalogOverrun
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogOverrun"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogOverrun.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogOverrun"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return AnalogOverrun.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies which analog channels are evaluated for threshold crossings on every ADC conversion.
+    /// </summary>
+    [Description("Specifies which analog channels are evaluated for threshold crossings on every ADC conversion.")]
+    public partial class AnalogThresholdEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogThresholdEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 47;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogThresholdEnable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogThresholdEnable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogThresholdEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogChannels GetPayload(HarpMessage message)
+        {
+            return (AnalogChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogThresholdEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((AnalogChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogThresholdEnable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogThresholdEnable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogThresholdEnable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogThresholdEnable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogThresholdEnable register.
+    /// </summary>
+    /// <seealso cref="AnalogThresholdEnable"/>
+    [Description("Filters and selects timestamped messages from the AnalogThresholdEnable register.")]
+    public partial class TimestampedAnalogThresholdEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogThresholdEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogThresholdEnable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogThresholdEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogChannels> GetPayload(HarpMessage message)
+        {
+            return AnalogThresholdEnable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the level at or above which each analog channel is considered above threshold.
+    /// </summary>
+    [Description("Specifies the level at or above which each analog channel is considered above threshold.")]
+    public partial class AnalogThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 48;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogThreshold"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static AnalogThresholdPayload ParsePayload(ushort[] payload)
+        {
+            AnalogThresholdPayload result;
+            result.AnalogInput0 = payload[0];
+            result.AnalogInput1 = payload[1];
+            result.AnalogInput2 = payload[2];
+            result.Temperature = payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(AnalogThresholdPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.AnalogInput0;
+            result[1] = value.AnalogInput1;
+            result[2] = value.AnalogInput2;
+            result[3] = value.Temperature;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogThresholdPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogThresholdPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogThreshold"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogThreshold"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogThresholdPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogThreshold"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogThreshold"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogThresholdPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogThreshold register.
+    /// </summary>
+    /// <seealso cref="AnalogThreshold"/>
+    [Description("Filters and selects timestamped messages from the AnalogThreshold register.")]
+    public partial class TimestampedAnalogThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogThreshold.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogThresholdPayload> GetPayload(HarpMessage message)
+        {
+            return AnalogThreshold.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies how far below the threshold each analog channel must fall before it is considered below threshold again.
+    /// </summary>
+    [Description("Specifies how far below the threshold each analog channel must fall before it is considered below threshold again.")]
+    public partial class AnalogHysteresis
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogHysteresis"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 49;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogHysteresis"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogHysteresis"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static AnalogHysteresisPayload ParsePayload(ushort[] payload)
+        {
+            AnalogHysteresisPayload result;
+            result.AnalogInput0 = payload[0];
+            result.AnalogInput1 = payload[1];
+            result.AnalogInput2 = payload[2];
+            result.Temperature = payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(AnalogHysteresisPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.AnalogInput0;
+            result[1] = value.AnalogInput1;
+            result[2] = value.AnalogInput2;
+            result[3] = value.Temperature;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogHysteresis"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogHysteresisPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogHysteresis"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogHysteresisPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogHysteresis"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogHysteresis"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogHysteresisPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogHysteresis"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogHysteresis"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogHysteresisPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogHysteresis register.
+    /// </summary>
+    /// <seealso cref="AnalogHysteresis"/>
+    [Description("Filters and selects timestamped messages from the AnalogHysteresis register.")]
+    public partial class TimestampedAnalogHysteresis
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogHysteresis"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogHysteresis.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogHysteresis"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogHysteresisPayload> GetPayload(HarpMessage message)
+        {
+            return AnalogHysteresis.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports which enabled analog channels are above threshold whenever any of them crosses its threshold. The message timestamp is the sample time of the conversion which caused the crossing.
+    /// </summary>
+    [Description("Reports which enabled analog channels are above threshold whenever any of them crosses its threshold. The message timestamp is the sample time of the conversion which caused the crossing.")]
+    public partial class AnalogThresholdCrossing
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogThresholdCrossing"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 50;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogThresholdCrossing"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogThresholdCrossing"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogThresholdCrossing"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogChannels GetPayload(HarpMessage message)
+        {
+            return (AnalogChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogThresholdCrossing"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((AnalogChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogThresholdCrossing"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogThresholdCrossing"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogThresholdCrossing"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogThresholdCrossing"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogThresholdCrossing register.
+    /// </summary>
+    /// <seealso cref="AnalogThresholdCrossing"/>
+    [Description("Filters and selects timestamped messages from the AnalogThresholdCrossing register.")]
+    public partial class TimestampedAnalogThresholdCrossing
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogThresholdCrossing"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogThresholdCrossing.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogThresholdCrossing"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogChannels> GetPayload(HarpMessage message)
+        {
+            return AnalogThresholdCrossing.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies whether analog frames are reported in the AnalogData or AnalogDataBatch registers. Disable to report only threshold crossings. Enabled by default.
+    /// </summary>
+    [Description("Specifies whether analog frames are reported in the AnalogData or AnalogDataBatch registers. Disable to report only threshold crossings. Enabled by default.")]
+    public partial class AnalogDataEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDataEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 51;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogDataEnable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogDataEnable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogDataEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EnableFlag GetPayload(HarpMessage message)
+        {
+            return (EnableFlag)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogDataEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EnableFlag)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogDataEnable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataEnable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogDataEnable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataEnable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogDataEnable register.
+    /// </summary>
+    /// <seealso cref="AnalogDataEnable"/>
+    [Description("Filters and selects timestamped messages from the AnalogDataEnable register.")]
+    public partial class TimestampedAnalogDataEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDataEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogDataEnable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogDataEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetPayload(HarpMessage message)
+        {
+            return AnalogDataEnable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the action applied by the firmware to the digital outputs when each analog channel crosses its threshold. Active reflexes shorten the ADC processing period to reduce reaction latency.
+    /// </summary>
+    [Description("Specifies the action applied by the firmware to the digital outputs when each analog channel crosses its threshold. Active reflexes shorten the ADC processing period to reduce reaction latency.")]
+    public partial class AnalogReflexAction
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogReflexAction"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 52;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogReflexAction"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogReflexAction"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static AnalogReflexActionPayload ParsePayload(byte[] payload)
+        {
+            AnalogReflexActionPayload result;
+            result.AnalogInput0 = (ReflexAction)payload[0];
+            result.AnalogInput1 = (ReflexAction)payload[1];
+            result.AnalogInput2 = (ReflexAction)payload[2];
+            result.Temperature = (ReflexAction)payload[3];
+            return result;
+        }
+
+        static byte[] FormatPayload(AnalogReflexActionPayload value)
+        {
+            byte[] result;
+            result = new byte[4];
+            result[0] = (byte)value.AnalogInput0;
+            result[1] = (byte)value.AnalogInput1;
+            result[2] = (byte)value.AnalogInput2;
+            result[3] = (byte)value.Temperature;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogReflexAction"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogReflexActionPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogReflexAction"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogReflexActionPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogReflexAction"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogReflexAction"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogReflexActionPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogReflexAction"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogReflexAction"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogReflexActionPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogReflexAction register.
+    /// </summary>
+    /// <seealso cref="AnalogReflexAction"/>
+    [Description("Filters and selects timestamped messages from the AnalogReflexAction register.")]
+    public partial class TimestampedAnalogReflexAction
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogReflexAction"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogReflexAction.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogReflexAction"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogReflexActionPayload> GetPayload(HarpMessage message)
+        {
+            return AnalogReflexAction.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital output lines driven by the reflex action of each analog channel.
+    /// </summary>
+    [Description("Specifies the digital output lines driven by the reflex action of each analog channel.")]
+    public partial class AnalogReflexOutput
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogReflexOutput"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 53;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogReflexOutput"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogReflexOutput"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static AnalogReflexOutputPayload ParsePayload(byte[] payload)
+        {
+            AnalogReflexOutputPayload result;
+            result.AnalogInput0 = (DigitalOutputs)payload[0];
+            result.AnalogInput1 = (DigitalOutputs)payload[1];
+            result.AnalogInput2 = (DigitalOutputs)payload[2];
+            result.Temperature = (DigitalOutputs)payload[3];
+            return result;
+        }
+
+        static byte[] FormatPayload(AnalogReflexOutputPayload value)
+        {
+            byte[] result;
+            result = new byte[4];
+            result[0] = (byte)value.AnalogInput0;
+            result[1] = (byte)value.AnalogInput1;
+            result[2] = (byte)value.AnalogInput2;
+            result[3] = (byte)value.Temperature;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogReflexOutput"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogReflexOutputPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogReflexOutput"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogReflexOutputPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogReflexOutput"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogReflexOutput"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogReflexOutputPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogReflexOutput"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogReflexOutput"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogReflexOutputPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogReflexOutput register.
+    /// </summary>
+    /// <seealso cref="AnalogReflexOutput"/>
+    [Description("Filters and selects timestamped messages from the AnalogReflexOutput register.")]
+    public partial class TimestampedAnalogReflexOutput
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogReflexOutput"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogReflexOutput.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogReflexOutput"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogReflexOutputPayload> GetPayload(HarpMessage message)
+        {
+            return AnalogReflexOutput.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the pulse train started by the PulseTrain reflex action.
+    /// </summary>
+    [Description("Specifies the pulse train started by the PulseTrain reflex action.")]
+    public partial class AnalogReflexPulseTrain
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogReflexPulseTrain"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 54;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogReflexPulseTrain"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogReflexPulseTrain"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        static AnalogReflexPulseTrainPayload ParsePayload(uint[] payload)
+        {
+            AnalogReflexPulseTrainPayload result;
+            result.PulseWidth = payload[0];
+            result.PulsePeriod = payload[1];
+            result.PulseCount = payload[2];
+            return result;
+        }
+
+        static uint[] FormatPayload(AnalogReflexPulseTrainPayload value)
+        {
+            uint[] result;
+            result = new uint[3];
+            result[0] = value.PulseWidth;
+            result[1] = value.PulsePeriod;
+            result[2] = value.PulseCount;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogReflexPulseTrain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogReflexPulseTrainPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogReflexPulseTrain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogReflexPulseTrainPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogReflexPulseTrain"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogReflexPulseTrain"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogReflexPulseTrainPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogReflexPulseTrain"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogReflexPulseTrain"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogReflexPulseTrainPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogReflexPulseTrain register.
+    /// </summary>
+    /// <seealso cref="AnalogReflexPulseTrain"/>
+    [Description("Filters and selects timestamped messages from the AnalogReflexPulseTrain register.")]
+    public partial class TimestampedAnalogReflexPulseTrain
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogReflexPulseTrain"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogReflexPulseTrain.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogReflexPulseTrain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogReflexPulseTrainPayload> GetPayload(HarpMessage message)
+        {
+            return AnalogReflexPulseTrain.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the source which triggers a capture of all enabled analog channels at the full ADC conversion rate.
+    /// </summary>
+    [Description("Specifies the source which triggers a capture of all enabled analog channels at the full ADC conversion rate.")]
+    public partial class AnalogCaptureTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCaptureTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 55;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogCaptureTrigger"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogCaptureTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogCaptureTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CaptureTrigger GetPayload(HarpMessage message)
+        {
+            return (CaptureTrigger)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogCaptureTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CaptureTrigger> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((CaptureTrigger)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogCaptureTrigger"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCaptureTrigger"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CaptureTrigger value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogCaptureTrigger"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCaptureTrigger"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CaptureTrigger value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogCaptureTrigger register.
+    /// </summary>
+    /// <seealso cref="AnalogCaptureTrigger"/>
+    [Description("Filters and selects timestamped messages from the AnalogCaptureTrigger register.")]
+    public partial class TimestampedAnalogCaptureTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCaptureTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogCaptureTrigger.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogCaptureTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CaptureTrigger> GetPayload(HarpMessage message)
+        {
+            return AnalogCaptureTrigger.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital input lines whose rising edge triggers a capture when AnalogCaptureTrigger is set to DigitalInput.
+    /// </summary>
+    [Description("Specifies the digital input lines whose rising edge triggers a capture when AnalogCaptureTrigger is set to DigitalInput.")]
+    public partial class AnalogCaptureDigitalInput
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCaptureDigitalInput"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 56;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogCaptureDigitalInput"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogCaptureDigitalInput"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogCaptureDigitalInput"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogCaptureDigitalInput"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogCaptureDigitalInput"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCaptureDigitalInput"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogCaptureDigitalInput"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCaptureDigitalInput"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogCaptureDigitalInput register.
+    /// </summary>
+    /// <seealso cref="AnalogCaptureDigitalInput"/>
+    [Description("Filters and selects timestamped messages from the AnalogCaptureDigitalInput register.")]
+    public partial class TimestampedAnalogCaptureDigitalInput
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCaptureDigitalInput"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogCaptureDigitalInput.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogCaptureDigitalInput"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return AnalogCaptureDigitalInput.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the capture window around the trigger, in scans of all enabled analog channels. The whole window can hold at most 4096 conversions.
+    /// </summary>
+    [Description("Specifies the capture window around the trigger, in scans of all enabled analog channels. The whole window can hold at most 4096 conversions.")]
+    public partial class AnalogCaptureWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCaptureWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 57;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogCaptureWindow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogCaptureWindow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static AnalogCaptureWindowPayload ParsePayload(ushort[] payload)
+        {
+            AnalogCaptureWindowPayload result;
+            result.PreTrigger = payload[0];
+            result.PostTrigger = payload[1];
+            return result;
+        }
+
+        static ushort[] FormatPayload(AnalogCaptureWindowPayload value)
+        {
+            ushort[] result;
+            result = new ushort[2];
+            result[0] = value.PreTrigger;
+            result[1] = value.PostTrigger;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogCaptureWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogCaptureWindowPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogCaptureWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogCaptureWindowPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogCaptureWindow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCaptureWindow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogCaptureWindowPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogCaptureWindow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCaptureWindow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogCaptureWindowPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogCaptureWindow register.
+    /// </summary>
+    /// <seealso cref="AnalogCaptureWindow"/>
+    [Description("Filters and selects timestamped messages from the AnalogCaptureWindow register.")]
+    public partial class TimestampedAnalogCaptureWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCaptureWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogCaptureWindow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogCaptureWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogCaptureWindowPayload> GetPayload(HarpMessage message)
+        {
+            return AnalogCaptureWindow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports a chunk of a triggered capture with interleaved raw conversions of the enabled channels. The message timestamp is the sample time of the first scan in the chunk, and each subsequent scan follows at the ADC conversion rate.
+    /// </summary>
+    [Description("Reports a chunk of a triggered capture with interleaved raw conversions of the enabled channels. The message timestamp is the sample time of the first scan in the chunk, and each subsequent scan follows at the ADC conversion rate.")]
+    public partial class AnalogCaptureData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCaptureData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 58;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogCaptureData"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogCaptureData"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 120;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogCaptureData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogCaptureData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogCaptureData"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCaptureData"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogCaptureData"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCaptureData"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogCaptureData register.
+    /// </summary>
+    /// <seealso cref="AnalogCaptureData"/>
+    [Description("Filters and selects timestamped messages from the AnalogCaptureData register.")]
+    public partial class TimestampedAnalogCaptureData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCaptureData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogCaptureData.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogCaptureData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return AnalogCaptureData.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the delay, in microseconds, between enabling events and starting analog acquisition.
+    /// </summary>
+    [Description("Specifies the delay, in microseconds, between enabling events and starting analog acquisition.")]
+    public partial class AnalogStartDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogStartDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 59;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogStartDelay"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogStartDelay"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogStartDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogStartDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogStartDelay"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogStartDelay"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogStartDelay"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogStartDelay"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogStartDelay register.
+    /// </summary>
+    /// <seealso cref="AnalogStartDelay"/>
+    [Description("Filters and selects timestamped messages from the AnalogStartDelay register.")]
+    public partial class TimestampedAnalogStartDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogStartDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogStartDelay.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogStartDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return AnalogStartDelay.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the time, in microseconds, from enabling analog acquisition until the first frame is available on the device. The message timestamp is the sample time of the first frame.
+    /// </summary>
+    [Description("Reports the time, in microseconds, from enabling analog acquisition until the first frame is available on the device. The message timestamp is the sample time of the first frame.")]
+    public partial class AnalogStartLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogStartLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 60;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogStartLatency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogStartLatency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogStartLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogStartLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogStartLatency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogStartLatency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogStartLatency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogStartLatency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogStartLatency register.
+    /// </summary>
+    /// <seealso cref="AnalogStartLatency"/>
+    [Description("Filters and selects timestamped messages from the AnalogStartLatency register.")]
+    public partial class TimestampedAnalogStartLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogStartLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogStartLatency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogStartLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return AnalogStartLatency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies whether each analog frame is reported as the minimum, maximum and mean of every enabled channel over the frame window, in the AnalogStatistics register.
+    /// </summary>
+    [Description("Specifies whether each analog frame is reported as the minimum, maximum and mean of every enabled channel over the frame window, in the AnalogStatistics register.")]
+    public partial class AnalogStatisticsEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogStatisticsEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 61;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogStatisticsEnable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogStatisticsEnable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogStatisticsEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EnableFlag GetPayload(HarpMessage message)
+        {
+            return (EnableFlag)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogStatisticsEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EnableFlag)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogStatisticsEnable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogStatisticsEnable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogStatisticsEnable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogStatisticsEnable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogStatisticsEnable register.
+    /// </summary>
+    /// <seealso cref="AnalogStatisticsEnable"/>
+    [Description("Filters and selects timestamped messages from the AnalogStatisticsEnable register.")]
+    public partial class TimestampedAnalogStatisticsEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogStatisticsEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogStatisticsEnable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogStatisticsEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetPayload(HarpMessage message)
+        {
+            return AnalogStatisticsEnable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the minimum, maximum and mean of the conversions of each enabled channel over a frame window, after the biquad filter and calibration are applied and before decimation, interleaved in ascending channel order. The message timestamp is the sample time of the first conversion in the window.
+    /// </summary>
+    [Description("Reports the minimum, maximum and mean of the conversions of each enabled channel over a frame window, after the biquad filter and calibration are applied and before decimation, interleaved in ascending channel order. The message timestamp is the sample time of the first conversion in the window.")]
+    public partial class AnalogStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 62;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogStatistics"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 12;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogStatistics"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogStatistics"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogStatistics"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogStatistics"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogStatistics register.
+    /// </summary>
+    /// <seealso cref="AnalogStatistics"/>
+    [Description("Filters and selects timestamped messages from the AnalogStatistics register.")]
+    public partial class TimestampedAnalogStatistics
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogStatistics"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogStatistics.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogStatistics"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return AnalogStatistics.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the offset added to every raw conversion of each analog channel before applying the calibration gain.
+    /// </summary>
+    [Description("Specifies the offset added to every raw conversion of each analog channel before applying the calibration gain.")]
+    public partial class AnalogCalibrationOffset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCalibrationOffset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 63;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogCalibrationOffset"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogCalibrationOffset"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static AnalogCalibrationOffsetPayload ParsePayload(short[] payload)
+        {
+            AnalogCalibrationOffsetPayload result;
+            result.AnalogInput0 = payload[0];
+            result.AnalogInput1 = payload[1];
+            result.AnalogInput2 = payload[2];
+            result.Temperature = payload[3];
+            return result;
+        }
+
+        static short[] FormatPayload(AnalogCalibrationOffsetPayload value)
+        {
+            short[] result;
+            result = new short[4];
+            result[0] = value.AnalogInput0;
+            result[1] = value.AnalogInput1;
+            result[2] = value.AnalogInput2;
+            result[3] = value.Temperature;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogCalibrationOffset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogCalibrationOffsetPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<short>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogCalibrationOffset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogCalibrationOffsetPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<short>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogCalibrationOffset"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCalibrationOffset"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogCalibrationOffsetPayload value)
+        {
+            return HarpMessage.FromInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogCalibrationOffset"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCalibrationOffset"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogCalibrationOffsetPayload value)
+        {
+            return HarpMessage.FromInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogCalibrationOffset register.
+    /// </summary>
+    /// <seealso cref="AnalogCalibrationOffset"/>
+    [Description("Filters and selects timestamped messages from the AnalogCalibrationOffset register.")]
+    public partial class TimestampedAnalogCalibrationOffset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCalibrationOffset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogCalibrationOffset.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogCalibrationOffset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogCalibrationOffsetPayload> GetPayload(HarpMessage message)
+        {
+            return AnalogCalibrationOffset.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the gain applied to every offset-corrected conversion of each analog channel, in Q14 fixed-point format where 16384 is unity gain.
+    /// </summary>
+    [Description("Specifies the gain applied to every offset-corrected conversion of each analog channel, in Q14 fixed-point format where 16384 is unity gain.")]
+    public partial class AnalogCalibrationGain
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCalibrationGain"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 64;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogCalibrationGain"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogCalibrationGain"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static AnalogCalibrationGainPayload ParsePayload(ushort[] payload)
+        {
+            AnalogCalibrationGainPayload result;
+            result.AnalogInput0 = payload[0];
+            result.AnalogInput1 = payload[1];
+            result.AnalogInput2 = payload[2];
+            result.Temperature = payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(AnalogCalibrationGainPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.AnalogInput0;
+            result[1] = value.AnalogInput1;
+            result[2] = value.AnalogInput2;
+            result[3] = value.Temperature;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogCalibrationGain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogCalibrationGainPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogCalibrationGain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogCalibrationGainPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogCalibrationGain"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCalibrationGain"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogCalibrationGainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogCalibrationGain"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCalibrationGain"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogCalibrationGainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogCalibrationGain register.
+    /// </summary>
+    /// <seealso cref="AnalogCalibrationGain"/>
+    [Description("Filters and selects timestamped messages from the AnalogCalibrationGain register.")]
+    public partial class TimestampedAnalogCalibrationGain
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCalibrationGain"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogCalibrationGain.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogCalibrationGain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogCalibrationGainPayload> GetPayload(HarpMessage message)
+        {
+            return AnalogCalibrationGain.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that stores the current analog calibration in flash, loads the stored calibration, or clears the current calibration. The stored calibration is loaded on reset.
+    /// </summary>
+    [Description("Stores the current analog calibration in flash, loads the stored calibration, or clears the current calibration. The stored calibration is loaded on reset.")]
+    public partial class AnalogCalibrationCommand
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCalibrationCommand"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 65;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogCalibrationCommand"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogCalibrationCommand"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogCalibrationCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CalibrationCommand GetPayload(HarpMessage message)
+        {
+            return (CalibrationCommand)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogCalibrationCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationCommand> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((CalibrationCommand)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogCalibrationCommand"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCalibrationCommand"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CalibrationCommand value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogCalibrationCommand"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogCalibrationCommand"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CalibrationCommand value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogCalibrationCommand register.
+    /// </summary>
+    /// <seealso cref="AnalogCalibrationCommand"/>
+    [Description("Filters and selects timestamped messages from the AnalogCalibrationCommand register.")]
+    public partial class TimestampedAnalogCalibrationCommand
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogCalibrationCommand"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogCalibrationCommand.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogCalibrationCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationCommand> GetPayload(HarpMessage message)
+        {
+            return AnalogCalibrationCommand.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the number of biquad filter sections, from zero to two, run on every conversion of each analog channel before calibration and decimation. Biquad sections can only run on enabled channels while the ADC conversion rate, AnalogSampleRate times AnalogDecimation times the number of enabled channels, is at most 100000 conversions per second. Writes exceeding this, to either this register or the analog configuration, are rejected.
+    /// </summary>
+    [Description("Specifies the number of biquad filter sections, from zero to two, run on every conversion of each analog channel before calibration and decimation. Biquad sections can only run on enabled channels while the ADC conversion rate, AnalogSampleRate times AnalogDecimation times the number of enabled channels, is at most 100000 conversions per second. Writes exceeding this, to either this register or the analog configuration, are rejected.")]
+    public partial class AnalogBiquadSections
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogBiquadSections"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 66;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogBiquadSections"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogBiquadSections"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static AnalogBiquadSectionsPayload ParsePayload(byte[] payload)
+        {
+            AnalogBiquadSectionsPayload result;
+            result.AnalogInput0 = payload[0];
+            result.AnalogInput1 = payload[1];
+            result.AnalogInput2 = payload[2];
+            result.Temperature = payload[3];
+            return result;
+        }
+
+        static byte[] FormatPayload(AnalogBiquadSectionsPayload value)
+        {
+            byte[] result;
+            result = new byte[4];
+            result[0] = value.AnalogInput0;
+            result[1] = value.AnalogInput1;
+            result[2] = value.AnalogInput2;
+            result[3] = value.Temperature;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogBiquadSections"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogBiquadSectionsPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogBiquadSections"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogBiquadSectionsPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogBiquadSections"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogBiquadSections"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogBiquadSectionsPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogBiquadSections"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogBiquadSections"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogBiquadSectionsPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogBiquadSections register.
+    /// </summary>
+    /// <seealso cref="AnalogBiquadSections"/>
+    [Description("Filters and selects timestamped messages from the AnalogBiquadSections register.")]
+    public partial class TimestampedAnalogBiquadSections
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogBiquadSections"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogBiquadSections.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogBiquadSections"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogBiquadSectionsPayload> GetPayload(HarpMessage message)
+        {
+            return AnalogBiquadSections.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the biquad filter coefficients b0, b1, b2, a1 and a2 of each section, in Q30 fixed-point format, for ADC channels 0 to 2 and the temperature sensor in turn. Each section implements (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2).
+    /// </summary>
+    [Description("Specifies the biquad filter coefficients b0, b1, b2, a1 and a2 of each section, in Q30 fixed-point format, for ADC channels 0 to 2 and the temperature sensor in turn. Each section implements (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2).")]
+    public partial class AnalogBiquadCoefficients
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogBiquadCoefficients"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 67;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogBiquadCoefficients"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogBiquadCoefficients"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 40;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogBiquadCoefficients"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<int>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogBiquadCoefficients"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<int>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogBiquadCoefficients"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogBiquadCoefficients"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int[] value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogBiquadCoefficients"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogBiquadCoefficients"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int[] value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogBiquadCoefficients register.
+    /// </summary>
+    /// <seealso cref="AnalogBiquadCoefficients"/>
+    [Description("Filters and selects timestamped messages from the AnalogBiquadCoefficients register.")]
+    public partial class TimestampedAnalogBiquadCoefficients
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogBiquadCoefficients"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogBiquadCoefficients.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogBiquadCoefficients"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int[]> GetPayload(HarpMessage message)
+        {
+            return AnalogBiquadCoefficients.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the format used to report analog frames. In the packed format, frames and batches are reported in the AnalogDataPacked register. In the compressed format, frames are reported in the AnalogDataCompressed register, and a batch size of zero fills each message.
+    /// </summary>
+    [Description("Specifies the format used to report analog frames. In the packed format, frames and batches are reported in the AnalogDataPacked register. In the compressed format, frames are reported in the AnalogDataCompressed register, and a batch size of zero fills each message.")]
+    public partial class AnalogDataFormat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDataFormat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 68;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogDataFormat"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogDataFormat"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogDataFormat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogDataFormat GetPayload(HarpMessage message)
+        {
+            return (AnalogDataFormat)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogDataFormat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogDataFormat> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((AnalogDataFormat)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogDataFormat"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataFormat"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogDataFormat value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogDataFormat"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataFormat"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogDataFormat value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogDataFormat register.
+    /// </summary>
+    /// <seealso cref="AnalogDataFormat"/>
+    [Description("Filters and selects timestamped messages from the AnalogDataFormat register.")]
+    public partial class TimestampedAnalogDataFormat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDataFormat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogDataFormat.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogDataFormat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogDataFormat> GetPayload(HarpMessage message)
+        {
+            return AnalogDataFormat.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports a batch of consecutive analog frames with interleaved values of the enabled channels, packing two 12-bit values in every three bytes. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+    /// </summary>
+    [Description("Reports a batch of consecutive analog frames with interleaved values of the enabled channels, packing two 12-bit values in every three bytes. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.")]
+    public partial class AnalogDataPacked
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDataPacked"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 69;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogDataPacked"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogDataPacked"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 180;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogDataPacked"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogDataPacked"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogDataPacked"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataPacked"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogDataPacked"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataPacked"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogDataPacked register.
+    /// </summary>
+    /// <seealso cref="AnalogDataPacked"/>
+    [Description("Filters and selects timestamped messages from the AnalogDataPacked register.")]
+    public partial class TimestampedAnalogDataPacked
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDataPacked"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogDataPacked.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogDataPacked"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return AnalogDataPacked.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports a delta compressed batch of consecutive analog frames. The first byte is the number of enabled channels, followed by the first frame as little-endian 16-bit values. Each subsequent value is the difference from the previous value of the same channel, zig-zag encoded as a little-endian base-128 varint. The message timestamp is the sample time of the first frame.
+    /// </summary>
+    [Description("Reports a delta compressed batch of consecutive analog frames. The first byte is the number of enabled channels, followed by the first frame as little-endian 16-bit values. Each subsequent value is the difference from the previous value of the same channel, zig-zag encoded as a little-endian base-128 varint. The message timestamp is the sample time of the first frame.")]
+    public partial class AnalogDataCompressed
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDataCompressed"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 70;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogDataCompressed"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogDataCompressed"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 240;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogDataCompressed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogDataCompressed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogDataCompressed"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataCompressed"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogDataCompressed"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogDataCompressed"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogDataCompressed register.
+    /// </summary>
+    /// <seealso cref="AnalogDataCompressed"/>
+    [Description("Filters and selects timestamped messages from the AnalogDataCompressed register.")]
+    public partial class TimestampedAnalogDataCompressed
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogDataCompressed"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogDataCompressed.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogDataCompressed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return AnalogDataCompressed.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the number of times acquisition was restarted to keep channels aligned after conversions were lost to an ADC FIFO overflow, or the DMA ring position no longer matched the conversions processed. The message timestamp is the sample time of the last conversion before the restart. Batches are never assembled across a restart or dropped frames, and are reported early instead.
+    /// </summary>
+    [Description("Reports the number of times acquisition was restarted to keep channels aligned after conversions were lost to an ADC FIFO overflow, or the DMA ring position no longer matched the conversions processed. The message timestamp is the sample time of the last conversion before the restart. Batches are never assembled across a restart or dropped frames, and are reported early instead.")]
+    public partial class AnalogResync
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogResync"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 71;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogResync"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogResync"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogResync"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogResync"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogResync"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogResync"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogResync"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogResync"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogResync register.
+    /// </summary>
+    /// <seealso cref="AnalogResync"/>
+    [Description("Filters and selects timestamped messages from the AnalogResync register.")]
+    public partial class TimestampedAnalogResync
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogResync"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogResync.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogResync"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return AnalogResync.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital output lines whose pulse trains trigger pulse-locked analog sampling. Every pulse of a pulse train using any of the specified lines reports a scan in the AnalogPulseSample register.
+    /// </summary>
+    [Description("Specifies the digital output lines whose pulse trains trigger pulse-locked analog sampling. Every pulse of a pulse train using any of the specified lines reports a scan in the AnalogPulseSample register.")]
+    public partial class AnalogPulseSampleOutputs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogPulseSampleOutputs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 72;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogPulseSampleOutputs"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogPulseSampleOutputs"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogPulseSampleOutputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalOutputs GetPayload(HarpMessage message)
+        {
+            return (DigitalOutputs)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogPulseSampleOutputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalOutputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DigitalOutputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogPulseSampleOutputs"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogPulseSampleOutputs"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalOutputs value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogPulseSampleOutputs"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogPulseSampleOutputs"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalOutputs value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogPulseSampleOutputs register.
+    /// </summary>
+    /// <seealso cref="AnalogPulseSampleOutputs"/>
+    [Description("Filters and selects timestamped messages from the AnalogPulseSampleOutputs register.")]
+    public partial class TimestampedAnalogPulseSampleOutputs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogPulseSampleOutputs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogPulseSampleOutputs.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogPulseSampleOutputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalOutputs> GetPayload(HarpMessage message)
+        {
+            return AnalogPulseSampleOutputs.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the delay, in microseconds, from the rising edge of each pulse to the analog scan reported in the AnalogPulseSample register.
+    /// </summary>
+    [Description("Specifies the delay, in microseconds, from the rising edge of each pulse to the analog scan reported in the AnalogPulseSample register.")]
+    public partial class AnalogPulseSampleDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogPulseSampleDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 73;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogPulseSampleDelay"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogPulseSampleDelay"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogPulseSampleDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogPulseSampleDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogPulseSampleDelay"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogPulseSampleDelay"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogPulseSampleDelay"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogPulseSampleDelay"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogPulseSampleDelay register.
+    /// </summary>
+    /// <seealso cref="AnalogPulseSampleDelay"/>
+    [Description("Filters and selects timestamped messages from the AnalogPulseSampleDelay register.")]
+    public partial class TimestampedAnalogPulseSampleDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogPulseSampleDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogPulseSampleDelay.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogPulseSampleDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return AnalogPulseSampleDelay.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the first scan of the enabled analog channels starting at the configured delay after a pulse. The payload holds the digital output lines of the pulse train, the zero-based index of the pulse in the train, and the calibrated values of the enabled channels in ascending channel order. The message timestamp is the sample time of the scan, which is resolved to the ADC conversion interval. Pulses whose scans cannot be reported are counted in AnalogPulseSampleOverrun.
+    /// </summary>
+    [Description("Reports the first scan of the enabled analog channels starting at the configured delay after a pulse. The payload holds the digital output lines of the pulse train, the zero-based index of the pulse in the train, and the calibrated values of the enabled channels in ascending channel order. The message timestamp is the sample time of the scan, which is resolved to the ADC conversion interval. Pulses whose scans cannot be reported are counted in AnalogPulseSampleOverrun.")]
+    public partial class AnalogPulseSample
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogPulseSample"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 74;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogPulseSample"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogPulseSample"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 6;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogPulseSample"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogPulseSample"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogPulseSample"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogPulseSample"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogPulseSample"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogPulseSample"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogPulseSample register.
+    /// </summary>
+    /// <seealso cref="AnalogPulseSample"/>
+    [Description("Filters and selects timestamped messages from the AnalogPulseSample register.")]
+    public partial class TimestampedAnalogPulseSample
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogPulseSample"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogPulseSample.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogPulseSample"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return AnalogPulseSample.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies whether each analog channel reports its amplitude envelope instead of its value. The envelope is computed on every conversion after removing a slowly tracked baseline, and averaged over each frame window, so AnalogDecimation sets the smoothing window at the reported rate.
+    /// </summary>
+    [Description("Specifies whether each analog channel reports its amplitude envelope instead of its value. The envelope is computed on every conversion after removing a slowly tracked baseline, and averaged over each frame window, so AnalogDecimation sets the smoothing window at the reported rate.")]
+    public partial class AnalogEnvelopeMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogEnvelopeMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 75;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogEnvelopeMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogEnvelopeMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static AnalogEnvelopeModePayload ParsePayload(byte[] payload)
+        {
+            AnalogEnvelopeModePayload result;
+            result.AnalogInput0 = (EnvelopeMode)payload[0];
+            result.AnalogInput1 = (EnvelopeMode)payload[1];
+            result.AnalogInput2 = (EnvelopeMode)payload[2];
+            result.Temperature = (EnvelopeMode)payload[3];
+            return result;
+        }
+
+        static byte[] FormatPayload(AnalogEnvelopeModePayload value)
+        {
+            byte[] result;
+            result = new byte[4];
+            result[0] = (byte)value.AnalogInput0;
+            result[1] = (byte)value.AnalogInput1;
+            result[2] = (byte)value.AnalogInput2;
+            result[3] = (byte)value.Temperature;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogEnvelopeMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AnalogEnvelopeModePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogEnvelopeMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogEnvelopeModePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogEnvelopeMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogEnvelopeMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AnalogEnvelopeModePayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogEnvelopeMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogEnvelopeMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AnalogEnvelopeModePayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogEnvelopeMode register.
+    /// </summary>
+    /// <seealso cref="AnalogEnvelopeMode"/>
+    [Description("Filters and selects timestamped messages from the AnalogEnvelopeMode register.")]
+    public partial class TimestampedAnalogEnvelopeMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogEnvelopeMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogEnvelopeMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogEnvelopeMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AnalogEnvelopeModePayload> GetPayload(HarpMessage message)
+        {
+            return AnalogEnvelopeMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the Harp time, in microseconds, at which the pulse train started by the next StartPulseTrain write emits its first rising edge. The value is cleared once it is used, and a value of zero starts the train immediately. Start times in the past are rejected by StartPulseTrain.
+    /// </summary>
+    [Description("Specifies the Harp time, in microseconds, at which the pulse train started by the next StartPulseTrain write emits its first rising edge. The value is cleared once it is used, and a value of zero starts the train immediately. Start times in the past are rejected by StartPulseTrain.")]
+    public partial class PulseTrainStartTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainStartTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 76;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseTrainStartTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U64;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseTrainStartTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseTrainStartTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ulong GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt64();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseTrainStartTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ulong> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt64();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseTrainStartTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainStartTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ulong value)
+        {
+            return HarpMessage.FromUInt64(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseTrainStartTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainStartTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ulong value)
+        {
+            return HarpMessage.FromUInt64(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseTrainStartTime register.
+    /// </summary>
+    /// <seealso cref="PulseTrainStartTime"/>
+    [Description("Filters and selects timestamped messages from the PulseTrainStartTime register.")]
+    public partial class TimestampedPulseTrainStartTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainStartTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseTrainStartTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseTrainStartTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ulong> GetPayload(HarpMessage message)
+        {
+            return PulseTrainStartTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital output sequence played by StartOutputSequence, as up to 30 pairs of step duration in microseconds and digital output state. The sequence ends at the first step with zero duration. Steps are played by a PIO state machine fed by DMA, so changes take effect on the next start.
+    /// </summary>
+    [Description("Specifies the digital output sequence played by StartOutputSequence, as up to 30 pairs of step duration in microseconds and digital output state. The sequence ends at the first step with zero duration. Steps are played by a PIO state machine fed by DMA, so changes take effect on the next start.")]
+    public partial class OutputSequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 77;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="OutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="OutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 60;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="OutputSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="OutputSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="OutputSequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OutputSequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="OutputSequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OutputSequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// OutputSequence register.
+    /// </summary>
+    /// <seealso cref="OutputSequence"/>
+    [Description("Filters and selects timestamped messages from the OutputSequence register.")]
+    public partial class TimestampedOutputSequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = OutputSequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="OutputSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return OutputSequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts playing the output sequence on the specified digital output lines, replacing any running sequence. The sequence stops any pulse train on the lines between its lowest and highest line, which are reported in StopPulseTrain, and starting a pulse train on those lines stops the sequence. Lines keep the state of the last step when the sequence ends.
+    /// </summary>
+    [Description("Starts playing the output sequence on the specified digital output lines, replacing any running sequence. The sequence stops any pulse train on the lines between its lowest and highest line, which are reported in StopPulseTrain, and starting a pulse train on those lines stops the sequence. Lines keep the state of the last step when the sequence ends.")]
+    public partial class StartOutputSequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StartOutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 78;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StartOutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StartOutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static StartOutputSequencePayload ParsePayload(byte[] payload)
+        {
+            StartOutputSequencePayload result;
+            result.DigitalOutput = (DigitalOutputs)payload[0];
+            result.LoopCount = payload[1];
+            return result;
+        }
+
+        static byte[] FormatPayload(StartOutputSequencePayload value)
+        {
+            byte[] result;
+            result = new byte[2];
+            result[0] = (byte)value.DigitalOutput;
+            result[1] = value.LoopCount;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StartOutputSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static StartOutputSequencePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StartOutputSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StartOutputSequencePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StartOutputSequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StartOutputSequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, StartOutputSequencePayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StartOutputSequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StartOutputSequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, StartOutputSequencePayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StartOutputSequence register.
+    /// </summary>
+    /// <seealso cref="StartOutputSequence"/>
+    [Description("Filters and selects timestamped messages from the StartOutputSequence register.")]
+    public partial class TimestampedStartOutputSequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StartOutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StartOutputSequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StartOutputSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<StartOutputSequencePayload> GetPayload(HarpMessage message)
+        {
+            return StartOutputSequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that stops the running output sequence when written with any value. Lines keep the state they were driven to.
+    /// </summary>
+    [Description("Stops the running output sequence when written with any value. Lines keep the state they were driven to.")]
+    public partial class StopOutputSequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StopOutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 79;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StopOutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StopOutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StopOutputSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StopOutputSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StopOutputSequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StopOutputSequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StopOutputSequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StopOutputSequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StopOutputSequence register.
+    /// </summary>
+    /// <seealso cref="StopOutputSequence"/>
+    [Description("Filters and selects timestamped messages from the StopOutputSequence register.")]
+    public partial class TimestampedStopOutputSequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StopOutputSequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StopOutputSequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StopOutputSequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return StopOutputSequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the digital output lines driven by the output sequence when it starts, and zero when it ends or is stopped.
+    /// </summary>
+    [Description("Reports the digital output lines driven by the output sequence when it starts, and zero when it ends or is stopped.")]
+    public partial class OutputSequenceState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OutputSequenceState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 80;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="OutputSequenceState"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="OutputSequenceState"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="OutputSequenceState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalOutputs GetPayload(HarpMessage message)
+        {
+            return (DigitalOutputs)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="OutputSequenceState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalOutputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DigitalOutputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="OutputSequenceState"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OutputSequenceState"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalOutputs value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="OutputSequenceState"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OutputSequenceState"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalOutputs value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// OutputSequenceState register.
+    /// </summary>
+    /// <seealso cref="OutputSequenceState"/>
+    [Description("Filters and selects timestamped messages from the OutputSequenceState register.")]
+    public partial class TimestampedOutputSequenceState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OutputSequenceState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = OutputSequenceState.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="OutputSequenceState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalOutputs> GetPayload(HarpMessage message)
+        {
+            return OutputSequenceState.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital output lines driven by the PWM hardware. Lines leaving PWM mode are driven low. Starting a pulse train or output sequence on a line takes it out of PWM mode, which is reported in this register, and enabling PWM on a line stops any pulse train or output sequence driving it.
+    /// </summary>
+    [Description("Specifies the digital output lines driven by the PWM hardware. Lines leaving PWM mode are driven low. Starting a pulse train or output sequence on a line takes it out of PWM mode, which is reported in this register, and enabling PWM on a line stops any pulse train or output sequence driving it.")]
+    public partial class PwmEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 81;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmEnable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmEnable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalOutputs GetPayload(HarpMessage message)
+        {
+            return (DigitalOutputs)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalOutputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DigitalOutputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmEnable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmEnable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalOutputs value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmEnable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmEnable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalOutputs value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmEnable register.
+    /// </summary>
+    /// <seealso cref="PwmEnable"/>
+    [Description("Filters and selects timestamped messages from the PwmEnable register.")]
+    public partial class TimestampedPwmEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmEnable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalOutputs> GetPayload(HarpMessage message)
+        {
+            return PwmEnable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the PWM frequency in Hz of each digital output line, from 8 Hz to half the system clock. Lines GP16-GP17, GP18-GP19 and GP20-GP21 share a PWM slice and must specify the same frequency while both are in PWM mode. The period is resolved to the slice clock, so high frequencies trade duty cycle resolution.
+    /// </summary>
+    [Description("Specifies the PWM frequency in Hz of each digital output line, from 8 Hz to half the system clock. Lines GP16-GP17, GP18-GP19 and GP20-GP21 share a PWM slice and must specify the same frequency while both are in PWM mode. The period is resolved to the slice clock, so high frequencies trade duty cycle resolution.")]
+    public partial class PwmFrequency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmFrequency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 82;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmFrequency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmFrequency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static PwmFrequencyPayload ParsePayload(uint[] payload)
+        {
+            PwmFrequencyPayload result;
+            result.GP15 = payload[0];
+            result.GP16 = payload[1];
+            result.GP17 = payload[2];
+            result.GP18 = payload[3];
+            result.GP19 = payload[4];
+            result.GP20 = payload[5];
+            result.GP21 = payload[6];
+            result.GP22 = payload[7];
+            return result;
+        }
+
+        static uint[] FormatPayload(PwmFrequencyPayload value)
+        {
+            uint[] result;
+            result = new uint[8];
+            result[0] = value.GP15;
+            result[1] = value.GP16;
+            result[2] = value.GP17;
+            result[3] = value.GP18;
+            result[4] = value.GP19;
+            result[5] = value.GP20;
+            result[6] = value.GP21;
+            result[7] = value.GP22;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmFrequency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PwmFrequencyPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmFrequency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PwmFrequencyPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmFrequency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmFrequency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PwmFrequencyPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmFrequency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmFrequency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PwmFrequencyPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmFrequency register.
+    /// </summary>
+    /// <seealso cref="PwmFrequency"/>
+    [Description("Filters and selects timestamped messages from the PwmFrequency register.")]
+    public partial class TimestampedPwmFrequency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmFrequency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmFrequency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmFrequency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PwmFrequencyPayload> GetPayload(HarpMessage message)
+        {
+            return PwmFrequency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the PWM duty cycle of each digital output line in hundredths of a percent, from 0 to 10000. Updates take effect at the end of the current PWM period, so the output does not glitch.
+    /// </summary>
+    [Description("Specifies the PWM duty cycle of each digital output line in hundredths of a percent, from 0 to 10000. Updates take effect at the end of the current PWM period, so the output does not glitch.")]
+    public partial class PwmDutyCycle
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmDutyCycle"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 83;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmDutyCycle"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmDutyCycle"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        static PwmDutyCyclePayload ParsePayload(ushort[] payload)
+        {
+            PwmDutyCyclePayload result;
+            result.GP15 = payload[0];
+            result.GP16 = payload[1];
+            result.GP17 = payload[2];
+            result.GP18 = payload[3];
+            result.GP19 = payload[4];
+            result.GP20 = payload[5];
+            result.GP21 = payload[6];
+            result.GP22 = payload[7];
+            return result;
+        }
+
+        static ushort[] FormatPayload(PwmDutyCyclePayload value)
+        {
+            ushort[] result;
+            result = new ushort[8];
+            result[0] = value.GP15;
+            result[1] = value.GP16;
+            result[2] = value.GP17;
+            result[3] = value.GP18;
+            result[4] = value.GP19;
+            result[5] = value.GP20;
+            result[6] = value.GP21;
+            result[7] = value.GP22;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmDutyCycle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PwmDutyCyclePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmDutyCycle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PwmDutyCyclePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmDutyCycle"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmDutyCycle"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PwmDutyCyclePayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmDutyCycle"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmDutyCycle"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PwmDutyCyclePayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmDutyCycle register.
+    /// </summary>
+    /// <seealso cref="PwmDutyCycle"/>
+    [Description("Filters and selects timestamped messages from the PwmDutyCycle register.")]
+    public partial class TimestampedPwmDutyCycle
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmDutyCycle"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmDutyCycle.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmDutyCycle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PwmDutyCyclePayload> GetPayload(HarpMessage message)
+        {
+            return PwmDutyCycle.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the events reported for pulse trains started from now on. StartStop reports the first pulse of each train and its summary, EveryNth and EveryPulse also report the selected pulses, and None reports neither. Defaults to None, so reporting is opt-in and hosts which do not read these registers receive no additional events. Reported pulses are timestamped at their rising edge, which is computed from the start time and period of the train, so reporting does not load the pulse generation.
+    /// </summary>
+    [Description("Specifies the events reported for pulse trains started from now on. StartStop reports the first pulse of each train and its summary, EveryNth and EveryPulse also report the selected pulses, and None reports neither. Defaults to None, so reporting is opt-in and hosts which do not read these registers receive no additional events. Reported pulses are timestamped at their rising edge, which is computed from the start time and period of the train, so reporting does not load the pulse generation.")]
+    public partial class PulseTrainReportMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainReportMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 84;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseTrainReportMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseTrainReportMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseTrainReportMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseTrainReportMode GetPayload(HarpMessage message)
+        {
+            return (PulseTrainReportMode)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseTrainReportMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseTrainReportMode> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((PulseTrainReportMode)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseTrainReportMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainReportMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseTrainReportMode value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseTrainReportMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainReportMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseTrainReportMode value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseTrainReportMode register.
+    /// </summary>
+    /// <seealso cref="PulseTrainReportMode"/>
+    [Description("Filters and selects timestamped messages from the PulseTrainReportMode register.")]
+    public partial class TimestampedPulseTrainReportMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainReportMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseTrainReportMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseTrainReportMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseTrainReportMode> GetPayload(HarpMessage message)
+        {
+            return PulseTrainReportMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the interval, in pulses, between the pulses reported when PulseTrainReportMode is EveryNth. The first pulse of the train is always reported.
+    /// </summary>
+    [Description("Specifies the interval, in pulses, between the pulses reported when PulseTrainReportMode is EveryNth. The first pulse of the train is always reported.")]
+    public partial class PulseTrainReportInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainReportInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 85;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseTrainReportInterval"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseTrainReportInterval"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseTrainReportInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseTrainReportInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseTrainReportInterval"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainReportInterval"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseTrainReportInterval"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainReportInterval"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseTrainReportInterval register.
+    /// </summary>
+    /// <seealso cref="PulseTrainReportInterval"/>
+    [Description("Filters and selects timestamped messages from the PulseTrainReportInterval register.")]
+    public partial class TimestampedPulseTrainReportInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainReportInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseTrainReportInterval.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseTrainReportInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return PulseTrainReportInterval.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports a pulse of a pulse train, timestamped at its rising edge. The payload holds the digital output lines of the train and the zero-based index of the pulse.
+    /// </summary>
+    [Description("Reports a pulse of a pulse train, timestamped at its rising edge. The payload holds the digital output lines of the train and the zero-based index of the pulse.")]
+    public partial class PulseTrainPulse
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainPulse"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 86;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseTrainPulse"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseTrainPulse"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static PulseTrainPulsePayload ParsePayload(uint[] payload)
+        {
+            PulseTrainPulsePayload result;
+            result.DigitalOutput = (DigitalOutputs)payload[0];
+            result.PulseIndex = payload[1];
+            return result;
+        }
+
+        static uint[] FormatPayload(PulseTrainPulsePayload value)
+        {
+            uint[] result;
+            result = new uint[2];
+            result[0] = (uint)value.DigitalOutput;
+            result[1] = value.PulseIndex;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseTrainPulse"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseTrainPulsePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseTrainPulse"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseTrainPulsePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseTrainPulse"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainPulse"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseTrainPulsePayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseTrainPulse"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainPulse"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseTrainPulsePayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseTrainPulse register.
+    /// </summary>
+    /// <seealso cref="PulseTrainPulse"/>
+    [Description("Filters and selects timestamped messages from the PulseTrainPulse register.")]
+    public partial class TimestampedPulseTrainPulse
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainPulse"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseTrainPulse.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseTrainPulse"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseTrainPulsePayload> GetPayload(HarpMessage message)
+        {
+            return PulseTrainPulse.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the summary of a reported pulse train once its last line stops, after all its reported pulses. Trains stopped before their first rising edge report zero pulses and zero timestamps. Up to 16 trains can be pending report, and trains started beyond that are not reported and are counted in PulseTrainReportOverrun.
+    /// </summary>
+    [Description("Reports the summary of a reported pulse train once its last line stops, after all its reported pulses. Trains stopped before their first rising edge report zero pulses and zero timestamps. Up to 16 trains can be pending report, and trains started beyond that are not reported and are counted in PulseTrainReportOverrun.")]
+    public partial class PulseTrainSummary
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainSummary"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 87;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseTrainSummary"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U64;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseTrainSummary"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static PulseTrainSummaryPayload ParsePayload(ulong[] payload)
+        {
+            PulseTrainSummaryPayload result;
+            result.DigitalOutput = payload[0];
+            result.PulseCount = payload[1];
+            result.FirstPulseTime = payload[2];
+            result.LastPulseTime = payload[3];
+            return result;
+        }
+
+        static ulong[] FormatPayload(PulseTrainSummaryPayload value)
+        {
+            ulong[] result;
+            result = new ulong[4];
+            result[0] = value.DigitalOutput;
+            result[1] = value.PulseCount;
+            result[2] = value.FirstPulseTime;
+            result[3] = value.LastPulseTime;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseTrainSummary"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseTrainSummaryPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ulong>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseTrainSummary"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseTrainSummaryPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ulong>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseTrainSummary"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainSummary"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseTrainSummaryPayload value)
+        {
+            return HarpMessage.FromUInt64(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseTrainSummary"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainSummary"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseTrainSummaryPayload value)
+        {
+            return HarpMessage.FromUInt64(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseTrainSummary register.
+    /// </summary>
+    /// <seealso cref="PulseTrainSummary"/>
+    [Description("Filters and selects timestamped messages from the PulseTrainSummary register.")]
+    public partial class TimestampedPulseTrainSummary
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainSummary"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseTrainSummary.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseTrainSummary"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseTrainSummaryPayload> GetPayload(HarpMessage message)
+        {
+            return PulseTrainSummary.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the bursts of finite pulse trains started from now on, including reflex pulse trains. Each burst plays the pulse count of the train, and bursts are timed on-device by the same state machine as the pulses. Pulses are numbered across bursts in pulse reports and pulse-locked sampling. The device loads each burst while the previous one plays, so the burst period must be at least 2000 microseconds. Storing the analog calibration blocks the device for longer than that, and may stretch the gap of bursts playing at the time.
+    /// </summary>
+    [Description("Specifies the bursts of finite pulse trains started from now on, including reflex pulse trains. Each burst plays the pulse count of the train, and bursts are timed on-device by the same state machine as the pulses. Pulses are numbered across bursts in pulse reports and pulse-locked sampling. The device loads each burst while the previous one plays, so the burst period must be at least 2000 microseconds. Storing the analog calibration blocks the device for longer than that, and may stretch the gap of bursts playing at the time.")]
+    public partial class PulseTrainBurst
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainBurst"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 88;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseTrainBurst"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseTrainBurst"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static PulseTrainBurstPayload ParsePayload(uint[] payload)
+        {
+            PulseTrainBurstPayload result;
+            result.BurstCount = payload[0];
+            result.BurstPeriod = payload[1];
+            return result;
+        }
+
+        static uint[] FormatPayload(PulseTrainBurstPayload value)
+        {
+            uint[] result;
+            result = new uint[2];
+            result[0] = value.BurstCount;
+            result[1] = value.BurstPeriod;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseTrainBurst"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static PulseTrainBurstPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseTrainBurst"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseTrainBurstPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseTrainBurst"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainBurst"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, PulseTrainBurstPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseTrainBurst"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainBurst"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, PulseTrainBurstPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseTrainBurst register.
+    /// </summary>
+    /// <seealso cref="PulseTrainBurst"/>
+    [Description("Filters and selects timestamped messages from the PulseTrainBurst register.")]
+    public partial class TimestampedPulseTrainBurst
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainBurst"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseTrainBurst.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseTrainBurst"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<PulseTrainBurstPayload> GetPayload(HarpMessage message)
+        {
+            return PulseTrainBurst.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the number of pulse trains left unreported because every report record was pending, and of output events such as StopPulseTrain and OutputSequenceState dropped because the device could not send them to the host in time.
+    /// </summary>
+    [Description("Reports the number of pulse trains left unreported because every report record was pending, and of output events such as StopPulseTrain and OutputSequenceState dropped because the device could not send them to the host in time.")]
+    public partial class PulseTrainReportOverrun
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainReportOverrun"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 89;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PulseTrainReportOverrun"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PulseTrainReportOverrun"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PulseTrainReportOverrun"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PulseTrainReportOverrun"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PulseTrainReportOverrun"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainReportOverrun"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PulseTrainReportOverrun"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PulseTrainReportOverrun"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PulseTrainReportOverrun register.
+    /// </summary>
+    /// <seealso cref="PulseTrainReportOverrun"/>
+    [Description("Filters and selects timestamped messages from the PulseTrainReportOverrun register.")]
+    public partial class TimestampedPulseTrainReportOverrun
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PulseTrainReportOverrun"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PulseTrainReportOverrun.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PulseTrainReportOverrun"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return PulseTrainReportOverrun.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the number of pulses whose AnalogPulseSample was dropped, either because the device could not send it to the host in time or because the scan was overwritten before it was read.
+    /// </summary>
+    [Description("Reports the number of pulses whose AnalogPulseSample was dropped, either because the device could not send it to the host in time or because the scan was overwritten before it was read.")]
+    public partial class AnalogPulseSampleOverrun
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogPulseSampleOverrun"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 90;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="AnalogPulseSampleOverrun"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="AnalogPulseSampleOverrun"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="AnalogPulseSampleOverrun"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="AnalogPulseSampleOverrun"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="AnalogPulseSampleOverrun"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogPulseSampleOverrun"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="AnalogPulseSampleOverrun"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="AnalogPulseSampleOverrun"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// AnalogPulseSampleOverrun register.
+    /// </summary>
+    /// <seealso cref="AnalogPulseSampleOverrun"/>
+    [Description("Filters and selects timestamped messages from the AnalogPulseSampleOverrun register.")]
+    public partial class TimestampedAnalogPulseSampleOverrun
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="AnalogPulseSampleOverrun"/> register. This field is constant.
+        /// </summary>
+        public const int Address = AnalogPulseSampleOverrun.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="AnalogPulseSampleOverrun"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return AnalogPulseSampleOverrun.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator which creates standard message payloads for the
+    /// Hobgoblin device.
+    /// </summary>
+    /// <seealso cref="CreateDigitalInputStatePayload"/>
+    /// <seealso cref="CreateDigitalOutputSetPayload"/>
+    /// <seealso cref="CreateDigitalOutputClearPayload"/>
+    /// <seealso cref="CreateDigitalOutputTogglePayload"/>
+    /// <seealso cref="CreateDigitalOutputStatePayload"/>
+    /// <seealso cref="CreateStartPulseTrainPayload"/>
+    /// <seealso cref="CreateStopPulseTrainPayload"/>
+    /// <seealso cref="CreateAnalogDataPayload"/>
+    /// <seealso cref="CreateAnalogSampleRatePayload"/>
+    /// <seealso cref="CreateAnalogDataBatchSizePayload"/>
+    /// <seealso cref="CreateAnalogDataBatchPayload"/>
+    /// <seealso cref="CreateAnalogDecimationPayload"/>
+    /// <seealso cref="CreateAnalogFilterOrderPayload"/>
+    /// <seealso cref="CreateAnalogChannelEnablePayload"/>
+    /// <seealso cref="CreateAnalogOverrunPayload"/>
+    /// <seealso cref="CreateAnalogThresholdEnablePayload"/>
+    /// <seealso cref="CreateAnalogThresholdPayload"/>
+    /// <seealso cref="CreateAnalogHysteresisPayload"/>
+    /// <seealso cref="CreateAnalogThresholdCrossingPayload"/>
+    /// <seealso cref="CreateAnalogDataEnablePayload"/>
+    /// <seealso cref="CreateAnalogReflexActionPayload"/>
+    /// <seealso cref="CreateAnalogReflexOutputPayload"/>
+    /// <seealso cref="CreateAnalogReflexPulseTrainPayload"/>
+    /// <seealso cref="CreateAnalogCaptureTriggerPayload"/>
+    /// <seealso cref="CreateAnalogCaptureDigitalInputPayload"/>
+    /// <seealso cref="CreateAnalogCaptureWindowPayload"/>
+    /// <seealso cref="CreateAnalogCaptureDataPayload"/>
+    /// <seealso cref="CreateAnalogStartDelayPayload"/>
+    /// <seealso cref="CreateAnalogStartLatencyPayload"/>
+    /// <seealso cref="CreateAnalogStatisticsEnablePayload"/>
+    /// <seealso cref="CreateAnalogStatisticsPayload"/>
+    /// <seealso cref="CreateAnalogCalibrationOffsetPayload"/>
+    /// <seealso cref="CreateAnalogCalibrationGainPayload"/>
+    /// <seealso cref="CreateAnalogCalibrationCommandPayload"/>
+    /// <seealso cref="CreateAnalogBiquadSectionsPayload"/>
+    /// <seealso cref="CreateAnalogBiquadCoefficientsPayload"/>
+    /// <seealso cref="CreateAnalogDataFormatPayload"/>
+    /// <seealso cref="CreateAnalogDataPackedPayload"/>
+    /// <seealso cref="CreateAnalogDataCompressedPayload"/>
+    /// <seealso cref="CreateAnalogResyncPayload"/>
+    /// <seealso cref="CreateAnalogPulseSampleOutputsPayload"/>
+    /// <seealso cref="CreateAnalogPulseSampleDelayPayload"/>
+    /// <seealso cref="CreateAnalogPulseSamplePayload"/>
+    /// <seealso cref="CreateAnalogEnvelopeModePayload"/>
+    /// <seealso cref="CreatePulseTrainStartTimePayload"/>
+    /// <seealso cref="CreateOutputSequencePayload"/>
+    /// <seealso cref="CreateStartOutputSequencePayload"/>
+    /// <seealso cref="CreateStopOutputSequencePayload"/>
+    /// <seealso cref="CreateOutputSequenceStatePayload"/>
+    /// <seealso cref="CreatePwmEnablePayload"/>
+    /// <seealso cref="CreatePwmFrequencyPayload"/>
+    /// <seealso cref="CreatePwmDutyCyclePayload"/>
+    /// <seealso cref="CreatePulseTrainReportModePayload"/>
+    /// <seealso cref="CreatePulseTrainReportIntervalPayload"/>
+    /// <seealso cref="CreatePulseTrainPulsePayload"/>
+    /// <seealso cref="CreatePulseTrainSummaryPayload"/>
+    /// <seealso cref="CreatePulseTrainBurstPayload"/>
+    /// <seealso cref="CreatePulseTrainReportOverrunPayload"/>
+    /// <seealso cref="CreateAnalogPulseSampleOverrunPayload"/>
+    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateDigitalOutputSetPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputClearPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputTogglePayload))]
+    [XmlInclude(typeof(CreateDigitalOutputStatePayload))]
+    [XmlInclude(typeof(CreateStartPulseTrainPayload))]
+    [XmlInclude(typeof(CreateStopPulseTrainPayload))]
+    [XmlInclude(typeof(CreateAnalogDataPayload))]
+    [XmlInclude(typeof(CreateAnalogSampleRatePayload))]
+    [XmlInclude(typeof(CreateAnalogDataBatchSizePayload))]
+    [XmlInclude(typeof(CreateAnalogDataBatchPayload))]
+    [XmlInclude(typeof(CreateAnalogDecimationPayload))]
+    [XmlInclude(typeof(CreateAnalogFilterOrderPayload))]
+    [XmlInclude(typeof(CreateAnalogChannelEnablePayload))]
+    [XmlInclude(typeof(CreateAnalogOverrunPayload))]
+    [XmlInclude(typeof(CreateAnalogThresholdEnablePayload))]
+    [XmlInclude(typeof(CreateAnalogThresholdPayload))]
+    [XmlInclude(typeof(CreateAnalogHysteresisPayload))]
+    [XmlInclude(typeof(CreateAnalogThresholdCrossingPayload))]
+    [XmlInclude(typeof(CreateAnalogDataEnablePayload))]
+    [XmlInclude(typeof(CreateAnalogReflexActionPayload))]
+    [XmlInclude(typeof(CreateAnalogReflexOutputPayload))]
+    [XmlInclude(typeof(CreateAnalogReflexPulseTrainPayload))]
+    [XmlInclude(typeof(CreateAnalogCaptureTriggerPayload))]
+    [XmlInclude(typeof(CreateAnalogCaptureDigitalInputPayload))]
+    [XmlInclude(typeof(CreateAnalogCaptureWindowPayload))]
+    [XmlInclude(typeof(CreateAnalogCaptureDataPayload))]
+    [XmlInclude(typeof(CreateAnalogStartDelayPayload))]
+    [XmlInclude(typeof(CreateAnalogStartLatencyPayload))]
+    [XmlInclude(typeof(CreateAnalogStatisticsEnablePayload))]
+    [XmlInclude(typeof(CreateAnalogStatisticsPayload))]
+    [XmlInclude(typeof(CreateAnalogCalibrationOffsetPayload))]
+    [XmlInclude(typeof(CreateAnalogCalibrationGainPayload))]
+    [XmlInclude(typeof(CreateAnalogCalibrationCommandPayload))]
+    [XmlInclude(typeof(CreateAnalogBiquadSectionsPayload))]
+    [XmlInclude(typeof(CreateAnalogBiquadCoefficientsPayload))]
+    [XmlInclude(typeof(CreateAnalogDataFormatPayload))]
+    [XmlInclude(typeof(CreateAnalogDataPackedPayload))]
+    [XmlInclude(typeof(CreateAnalogDataCompressedPayload))]
+    [XmlInclude(typeof(CreateAnalogResyncPayload))]
+    [XmlInclude(typeof(CreateAnalogPulseSampleOutputsPayload))]
+    [XmlInclude(typeof(CreateAnalogPulseSampleDelayPayload))]
+    [XmlInclude(typeof(CreateAnalogPulseSamplePayload))]
+    [XmlInclude(typeof(CreateAnalogEnvelopeModePayload))]
+    [XmlInclude(typeof(CreatePulseTrainStartTimePayload))]
+    [XmlInclude(typeof(CreateOutputSequencePayload))]
+    [XmlInclude(typeof(CreateStartOutputSequencePayload))]
+    [XmlInclude(typeof(CreateStopOutputSequencePayload))]
+    [XmlInclude(typeof(CreateOutputSequenceStatePayload))]
+    [XmlInclude(typeof(CreatePwmEnablePayload))]
+    [XmlInclude(typeof(CreatePwmFrequencyPayload))]
+    [XmlInclude(typeof(CreatePwmDutyCyclePayload))]
+    [XmlInclude(typeof(CreatePulseTrainReportModePayload))]
+    [XmlInclude(typeof(CreatePulseTrainReportIntervalPayload))]
+    [XmlInclude(typeof(CreatePulseTrainPulsePayload))]
+    [XmlInclude(typeof(CreatePulseTrainSummaryPayload))]
+    [XmlInclude(typeof(CreatePulseTrainBurstPayload))]
+    [XmlInclude(typeof(CreatePulseTrainReportOverrunPayload))]
+    [XmlInclude(typeof(CreateAnalogPulseSampleOverrunPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputSetPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputTogglePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedStartPulseTrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedStopPulseTrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogSampleRatePayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogDataBatchSizePayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogDataBatchPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogDecimationPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogFilterOrderPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogChannelEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogOverrunPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogThresholdEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogHysteresisPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogThresholdCrossingPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogDataEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogReflexActionPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogReflexOutputPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogReflexPulseTrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogCaptureTriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogCaptureDigitalInputPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogCaptureWindowPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogCaptureDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogStartDelayPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogStartLatencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogStatisticsEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogStatisticsPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogCalibrationOffsetPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogCalibrationGainPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogCalibrationCommandPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogBiquadSectionsPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogBiquadCoefficientsPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogDataFormatPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogDataPackedPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogDataCompressedPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogResyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogPulseSampleOutputsPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogPulseSampleDelayPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogPulseSamplePayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogEnvelopeModePayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseTrainStartTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputSequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedStartOutputSequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedStopOutputSequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputSequenceStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmFrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmDutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseTrainReportModePayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseTrainReportIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseTrainPulsePayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseTrainSummaryPayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseTrainBurstPayload))]
+    [XmlInclude(typeof(CreateTimestampedPulseTrainReportOverrunPayload))]
+    [XmlInclude(typeof(CreateTimestampedAnalogPulseSampleOverrunPayload))]
+    [Description("Creates standard message payloads for the Hobgoblin device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateDigitalInputStatePayload();
+        }
+
+        string INamedElement.Name => $"{nameof(Hobgoblin)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reflects the state of the digital input lines.
+    /// </summary>
+    [DisplayName("DigitalInputStatePayload")]
+    [Description("Creates a message payload that reflects the state of the digital input lines.")]
+    public partial class CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reflects the state of the digital input lines.
+        /// </summary>
+        [Description("The value that reflects the state of the digital input lines.")]
+        public DigitalInputs DigitalInputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DigitalInputState;
+        }
+
+        /// <summary>
+        /// Creates a message that reflects the state of the digital input lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.DigitalInputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reflects the state of the digital input lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputStatePayload")]
+    [Description("Creates a timestamped message payload that reflects the state of the digital input lines.")]
+    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reflects the state of the digital input lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputSetPayload")]
+    [Description("Creates a message payload that sets the specified digital output lines.")]
+    public partial class CreateDigitalOutputSetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the specified digital output lines.
+        /// </summary>
+        [Description("The value that sets the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputSet { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputSet register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputSet;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputSet register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.DigitalOutputSet.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputSetPayload")]
+    [Description("Creates a timestamped message payload that sets the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputSetPayload : CreateDigitalOutputSetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputSet register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.DigitalOutputSet.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that clears the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputClearPayload")]
+    [Description("Creates a message payload that clears the specified digital output lines.")]
+    public partial class CreateDigitalOutputClearPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that clears the specified digital output lines.
+        /// </summary>
+        [Description("The value that clears the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputClear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputClear register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputClear;
+        }
+
+        /// <summary>
+        /// Creates a message that clears the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputClear register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.DigitalOutputClear.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that clears the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputClearPayload")]
+    [Description("Creates a timestamped message payload that clears the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputClearPayload : CreateDigitalOutputClearPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that clears the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputClear register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.DigitalOutputClear.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that toggles the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputTogglePayload")]
+    [Description("Creates a message payload that toggles the specified digital output lines.")]
+    public partial class CreateDigitalOutputTogglePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that toggles the specified digital output lines.
+        /// </summary>
+        [Description("The value that toggles the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputToggle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputToggle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputToggle;
+        }
+
+        /// <summary>
+        /// Creates a message that toggles the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputToggle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.DigitalOutputToggle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that toggles the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputTogglePayload")]
+    [Description("Creates a timestamped message payload that toggles the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputTogglePayload : CreateDigitalOutputTogglePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that toggles the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputToggle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.DigitalOutputToggle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that writes the state of all digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputStatePayload")]
+    [Description("Creates a message payload that writes the state of all digital output lines.")]
+    public partial class CreateDigitalOutputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that writes the state of all digital output lines.
+        /// </summary>
+        [Description("The value that writes the state of all digital output lines.")]
+        public DigitalOutputs DigitalOutputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputState;
+        }
+
+        /// <summary>
+        /// Creates a message that writes the state of all digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.DigitalOutputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that writes the state of all digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputStatePayload")]
+    [Description("Creates a timestamped message payload that writes the state of all digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputStatePayload : CreateDigitalOutputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that writes the state of all digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.DigitalOutputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that starts a pulse train driving the specified digital output lines. Pulses are generated by a PIO state machine with sub-microsecond edge timing and no per-pulse events. Each line runs independently, and a new train replaces any train running on its lines, which are reported in StopPulseTrain. Lines 0-3 and lines 4-7 run on separate PIO blocks, so edges are aligned within each group but a train spanning both starts lines 4-7 a few system clock cycles after lines 0-3, under 100 ns. The pulse width must be shorter than the period. Finite trains are repeated in bursts as specified by PulseTrainBurst.
+    /// </summary>
+    [DisplayName("StartPulseTrainPayload")]
+    [Description("Creates a message payload that starts a pulse train driving the specified digital output lines. Pulses are generated by a PIO state machine with sub-microsecond edge timing and no per-pulse events. Each line runs independently, and a new train replaces any train running on its lines, which are reported in StopPulseTrain. Lines 0-3 and lines 4-7 run on separate PIO blocks, so edges are aligned within each group but a train spanning both starts lines 4-7 a few system clock cycles after lines 0-3, under 100 ns. The pulse width must be shorter than the period. Finite trains are repeated in bursts as specified by PulseTrainBurst.")]
+    public partial class CreateStartPulseTrainPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the digital output lines set by each pulse of the pulse train.
+        /// </summary>
+        [Description("Specifies the digital output lines set by each pulse of the pulse train.")]
+        public DigitalOutputs DigitalOutput { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the duration in microseconds that each pulse is HIGH.
+        /// </summary>
+        [Description("Specifies the duration in microseconds that each pulse is HIGH.")]
+        public uint PulseWidth { get; set; } = 500000;
+
+        /// <summary>
+        /// Gets or sets a value that specifies the interval in microseconds between each pulse in the pulse train.
+        /// </summary>
+        [Description("Specifies the interval in microseconds between each pulse in the pulse train.")]
+        public uint PulsePeriod { get; set; } = 1000000;
+
+        /// <summary>
+        /// Gets or sets a value that specifies the number of pulses in the PWM pulse train, or in each burst. A value of zero signifies an infinite pulse train.
+        /// </summary>
+        [Description("Specifies the number of pulses in the PWM pulse train, or in each burst. A value of zero signifies an infinite pulse train.")]
+        public uint PulseCount { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the StartPulseTrain register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public StartPulseTrainPayload GetPayload()
+        {
+            StartPulseTrainPayload value;
+            value.DigitalOutput = DigitalOutput;
+            value.PulseWidth = PulseWidth;
+            value.PulsePeriod = PulsePeriod;
+            value.PulseCount = PulseCount;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that starts a pulse train driving the specified digital output lines. Pulses are generated by a PIO state machine with sub-microsecond edge timing and no per-pulse events. Each line runs independently, and a new train replaces any train running on its lines, which are reported in StopPulseTrain. Lines 0-3 and lines 4-7 run on separate PIO blocks, so edges are aligned within each group but a train spanning both starts lines 4-7 a few system clock cycles after lines 0-3, under 100 ns. The pulse width must be shorter than the period. Finite trains are repeated in bursts as specified by PulseTrainBurst.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StartPulseTrain register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.StartPulseTrain.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that starts a pulse train driving the specified digital output lines. Pulses are generated by a PIO state machine with sub-microsecond edge timing and no per-pulse events. Each line runs independently, and a new train replaces any train running on its lines, which are reported in StopPulseTrain. Lines 0-3 and lines 4-7 run on separate PIO blocks, so edges are aligned within each group but a train spanning both starts lines 4-7 a few system clock cycles after lines 0-3, under 100 ns. The pulse width must be shorter than the period. Finite trains are repeated in bursts as specified by PulseTrainBurst.
+    /// </summary>
+    [DisplayName("TimestampedStartPulseTrainPayload")]
+    [Description("Creates a timestamped message payload that starts a pulse train driving the specified digital output lines. Pulses are generated by a PIO state machine with sub-microsecond edge timing and no per-pulse events. Each line runs independently, and a new train replaces any train running on its lines, which are reported in StopPulseTrain. Lines 0-3 and lines 4-7 run on separate PIO blocks, so edges are aligned within each group but a train spanning both starts lines 4-7 a few system clock cycles after lines 0-3, under 100 ns. The pulse width must be shorter than the period. Finite trains are repeated in bursts as specified by PulseTrainBurst.")]
+    public partial class CreateTimestampedStartPulseTrainPayload : CreateStartPulseTrainPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that starts a pulse train driving the specified digital output lines. Pulses are generated by a PIO state machine with sub-microsecond edge timing and no per-pulse events. Each line runs independently, and a new train replaces any train running on its lines, which are reported in StopPulseTrain. Lines 0-3 and lines 4-7 run on separate PIO blocks, so edges are aligned within each group but a train spanning both starts lines 4-7 a few system clock cycles after lines 0-3, under 100 ns. The pulse width must be shorter than the period. Finite trains are repeated in bursts as specified by PulseTrainBurst.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StartPulseTrain register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.StartPulseTrain.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that stops the pulse train running on the specified digital output lines. Lines of the same train which are not specified keep running. Reports the lines of trains which complete or are replaced.
+    /// </summary>
+    [DisplayName("StopPulseTrainPayload")]
+    [Description("Creates a message payload that stops the pulse train running on the specified digital output lines. Lines of the same train which are not specified keep running. Reports the lines of trains which complete or are replaced.")]
+    public partial class CreateStopPulseTrainPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that stops the pulse train running on the specified digital output lines. Lines of the same train which are not specified keep running. Reports the lines of trains which complete or are replaced.
+        /// </summary>
+        [Description("The value that stops the pulse train running on the specified digital output lines. Lines of the same train which are not specified keep running. Reports the lines of trains which complete or are replaced.")]
+        public DigitalOutputs StopPulseTrain { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StopPulseTrain register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return StopPulseTrain;
+        }
+
+        /// <summary>
+        /// Creates a message that stops the pulse train running on the specified digital output lines. Lines of the same train which are not specified keep running. Reports the lines of trains which complete or are replaced.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StopPulseTrain register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.StopPulseTrain.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that stops the pulse train running on the specified digital output lines. Lines of the same train which are not specified keep running. Reports the lines of trains which complete or are replaced.
+    /// </summary>
+    [DisplayName("TimestampedStopPulseTrainPayload")]
+    [Description("Creates a timestamped message payload that stops the pulse train running on the specified digital output lines. Lines of the same train which are not specified keep running. Reports the lines of trains which complete or are replaced.")]
+    public partial class CreateTimestampedStopPulseTrainPayload : CreateStopPulseTrainPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that stops the pulse train running on the specified digital output lines. Lines of the same train which are not specified keep running. Reports the lines of trains which complete or are replaced.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StopPulseTrain register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.StopPulseTrain.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution. Channels disabled in AnalogChannelEnable report zero. When the temperature sensor is enabled, its value follows as a fourth value, filtered and calibrated like the analog inputs.
+    /// </summary>
+    [DisplayName("AnalogDataPayload")]
+    [Description("Creates a message payload that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution. Channels disabled in AnalogChannelEnable report zero. When the temperature sensor is enabled, its value follows as a fourth value, filtered and calibrated like the analog inputs.")]
+    public partial class CreateAnalogDataPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the analog value sampled from ADC channel 0.
+        /// </summary>
+        [Description("The analog value sampled from ADC channel 0.")]
+        public ushort AnalogInput0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the analog value sampled from ADC channel 1.
+        /// </summary>
+        [Description("The analog value sampled from ADC channel 1.")]
+        public ushort AnalogInput1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the analog value sampled from ADC channel 2.
+        /// </summary>
+        [Description("The analog value sampled from ADC channel 2.")]
+        public ushort AnalogInput2 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogData register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogDataPayload GetPayload()
+        {
+            AnalogDataPayload value;
+            value.AnalogInput0 = AnalogInput0;
+            value.AnalogInput1 = AnalogInput1;
+            value.AnalogInput2 = AnalogInput2;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution. Channels disabled in AnalogChannelEnable report zero. When the temperature sensor is enabled, its value follows as a fourth value, filtered and calibrated like the analog inputs.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogData register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogData.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution. Channels disabled in AnalogChannelEnable report zero. When the temperature sensor is enabled, its value follows as a fourth value, filtered and calibrated like the analog inputs.
+    /// </summary>
+    [DisplayName("TimestampedAnalogDataPayload")]
+    [Description("Creates a timestamped message payload that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution. Channels disabled in AnalogChannelEnable report zero. When the temperature sensor is enabled, its value follows as a fourth value, filtered and calibrated like the analog inputs.")]
+    public partial class CreateTimestampedAnalogDataPayload : CreateAnalogDataPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution. Channels disabled in AnalogChannelEnable report zero. When the temperature sensor is enabled, its value follows as a fourth value, filtered and calibrated like the analog inputs.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogData register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogData.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the rate, in Hz, at which analog frames are sampled and reported. The ADC clock is paced so every conversion is filtered into a reported frame.
+    /// </summary>
+    [DisplayName("AnalogSampleRatePayload")]
+    [Description("Creates a message payload that specifies the rate, in Hz, at which analog frames are sampled and reported. The ADC clock is paced so every conversion is filtered into a reported frame.")]
+    public partial class CreateAnalogSampleRatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the rate, in Hz, at which analog frames are sampled and reported. The ADC clock is paced so every conversion is filtered into a reported frame.
+        /// </summary>
+        [Range(min: 1, max: 500000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that specifies the rate, in Hz, at which analog frames are sampled and reported. The ADC clock is paced so every conversion is filtered into a reported frame.")]
+        public uint AnalogSampleRate { get; set; } = 250;
+
+        /// <summary>
+        /// Creates a message payload for the AnalogSampleRate register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return AnalogSampleRate;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the rate, in Hz, at which analog frames are sampled and reported. The ADC clock is paced so every conversion is filtered into a reported frame.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogSampleRate register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogSampleRate.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the rate, in Hz, at which analog frames are sampled and reported. The ADC clock is paced so every conversion is filtered into a reported frame.
+    /// </summary>
+    [DisplayName("TimestampedAnalogSampleRatePayload")]
+    [Description("Creates a timestamped message payload that specifies the rate, in Hz, at which analog frames are sampled and reported. The ADC clock is paced so every conversion is filtered into a reported frame.")]
+    public partial class CreateTimestampedAnalogSampleRatePayload : CreateAnalogSampleRatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the rate, in Hz, at which analog frames are sampled and reported. The ADC clock is paced so every conversion is filtered into a reported frame.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogSampleRate register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogSampleRate.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the number of consecutive analog frames reported in each AnalogDataBatch event. A value of zero reports each frame individually in the AnalogData register. Each batch can hold at most 120 values across all enabled channels.
+    /// </summary>
+    [DisplayName("AnalogDataBatchSizePayload")]
+    [Description("Creates a message payload that specifies the number of consecutive analog frames reported in each AnalogDataBatch event. A value of zero reports each frame individually in the AnalogData register. Each batch can hold at most 120 values across all enabled channels.")]
+    public partial class CreateAnalogDataBatchSizePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the number of consecutive analog frames reported in each AnalogDataBatch event. A value of zero reports each frame individually in the AnalogData register. Each batch can hold at most 120 values across all enabled channels.
+        /// </summary>
+        [Range(min: 0, max: 120)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that specifies the number of consecutive analog frames reported in each AnalogDataBatch event. A value of zero reports each frame individually in the AnalogData register. Each batch can hold at most 120 values across all enabled channels.")]
+        public byte AnalogDataBatchSize { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the AnalogDataBatchSize register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return AnalogDataBatchSize;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the number of consecutive analog frames reported in each AnalogDataBatch event. A value of zero reports each frame individually in the AnalogData register. Each batch can hold at most 120 values across all enabled channels.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogDataBatchSize register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataBatchSize.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the number of consecutive analog frames reported in each AnalogDataBatch event. A value of zero reports each frame individually in the AnalogData register. Each batch can hold at most 120 values across all enabled channels.
+    /// </summary>
+    [DisplayName("TimestampedAnalogDataBatchSizePayload")]
+    [Description("Creates a timestamped message payload that specifies the number of consecutive analog frames reported in each AnalogDataBatch event. A value of zero reports each frame individually in the AnalogData register. Each batch can hold at most 120 values across all enabled channels.")]
+    public partial class CreateTimestampedAnalogDataBatchSizePayload : CreateAnalogDataBatchSizePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the number of consecutive analog frames reported in each AnalogDataBatch event. A value of zero reports each frame individually in the AnalogData register. Each batch can hold at most 120 values across all enabled channels.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogDataBatchSize register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataBatchSize.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports a batch of consecutive analog frames with interleaved values of the enabled channels, in ascending channel order. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+    /// </summary>
+    [DisplayName("AnalogDataBatchPayload")]
+    [Description("Creates a message payload that reports a batch of consecutive analog frames with interleaved values of the enabled channels, in ascending channel order. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.")]
+    public partial class CreateAnalogDataBatchPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports a batch of consecutive analog frames with interleaved values of the enabled channels, in ascending channel order. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+        /// </summary>
+        [Description("The value that reports a batch of consecutive analog frames with interleaved values of the enabled channels, in ascending channel order. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.")]
+        public ushort[] AnalogDataBatch { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogDataBatch register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return AnalogDataBatch;
+        }
+
+        /// <summary>
+        /// Creates a message that reports a batch of consecutive analog frames with interleaved values of the enabled channels, in ascending channel order. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogDataBatch register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataBatch.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports a batch of consecutive analog frames with interleaved values of the enabled channels, in ascending channel order. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+    /// </summary>
+    [DisplayName("TimestampedAnalogDataBatchPayload")]
+    [Description("Creates a timestamped message payload that reports a batch of consecutive analog frames with interleaved values of the enabled channels, in ascending channel order. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.")]
+    public partial class CreateTimestampedAnalogDataBatchPayload : CreateAnalogDataBatchPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports a batch of consecutive analog frames with interleaved values of the enabled channels, in ascending channel order. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogDataBatch register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataBatch.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the minimum number of scans of all analog channels decimated into each reported frame. The ADC conversion rate is increased accordingly.
+    /// </summary>
+    [DisplayName("AnalogDecimationPayload")]
+    [Description("Creates a message payload that specifies the minimum number of scans of all analog channels decimated into each reported frame. The ADC conversion rate is increased accordingly.")]
+    public partial class CreateAnalogDecimationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the minimum number of scans of all analog channels decimated into each reported frame. The ADC conversion rate is increased accordingly.
+        /// </summary>
+        [Range(min: 1, max: 1024)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that specifies the minimum number of scans of all analog channels decimated into each reported frame. The ADC conversion rate is increased accordingly.")]
+        public ushort AnalogDecimation { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the AnalogDecimation register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return AnalogDecimation;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the minimum number of scans of all analog channels decimated into each reported frame. The ADC conversion rate is increased accordingly.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogDecimation register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDecimation.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the minimum number of scans of all analog channels decimated into each reported frame. The ADC conversion rate is increased accordingly.
+    /// </summary>
+    [DisplayName("TimestampedAnalogDecimationPayload")]
+    [Description("Creates a timestamped message payload that specifies the minimum number of scans of all analog channels decimated into each reported frame. The ADC conversion rate is increased accordingly.")]
+    public partial class CreateTimestampedAnalogDecimationPayload : CreateAnalogDecimationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the minimum number of scans of all analog channels decimated into each reported frame. The ADC conversion rate is increased accordingly.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogDecimation register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDecimation.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the order of the CIC decimation filter applied to each analog channel. A value of one is a boxcar average over each frame.
+    /// </summary>
+    [DisplayName("AnalogFilterOrderPayload")]
+    [Description("Creates a message payload that specifies the order of the CIC decimation filter applied to each analog channel. A value of one is a boxcar average over each frame.")]
+    public partial class CreateAnalogFilterOrderPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the order of the CIC decimation filter applied to each analog channel. A value of one is a boxcar average over each frame.
+        /// </summary>
+        [Range(min: 1, max: 3)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that specifies the order of the CIC decimation filter applied to each analog channel. A value of one is a boxcar average over each frame.")]
+        public byte AnalogFilterOrder { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the AnalogFilterOrder register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return AnalogFilterOrder;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the order of the CIC decimation filter applied to each analog channel. A value of one is a boxcar average over each frame.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogFilterOrder register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogFilterOrder.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the order of the CIC decimation filter applied to each analog channel. A value of one is a boxcar average over each frame.
+    /// </summary>
+    [DisplayName("TimestampedAnalogFilterOrderPayload")]
+    [Description("Creates a timestamped message payload that specifies the order of the CIC decimation filter applied to each analog channel. A value of one is a boxcar average over each frame.")]
+    public partial class CreateTimestampedAnalogFilterOrderPayload : CreateAnalogFilterOrderPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the order of the CIC decimation filter applied to each analog channel. A value of one is a boxcar average over each frame.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogFilterOrder register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogFilterOrder.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies which analog channels are sampled. The ADC conversion rate is shared between all enabled channels. The internal temperature sensor is sampled, filtered and calibrated like the analog inputs when Temperature is enabled. By default all three analog inputs are enabled.
+    /// </summary>
+    [DisplayName("AnalogChannelEnablePayload")]
+    [Description("Creates a message payload that specifies which analog channels are sampled. The ADC conversion rate is shared between all enabled channels. The internal temperature sensor is sampled, filtered and calibrated like the analog inputs when Temperature is enabled. By default all three analog inputs are enabled.")]
+    public partial class CreateAnalogChannelEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies which analog channels are sampled. The ADC conversion rate is shared between all enabled channels. The internal temperature sensor is sampled, filtered and calibrated like the analog inputs when Temperature is enabled. By default all three analog inputs are enabled.
+        /// </summary>
+        [Description("The value that specifies which analog channels are sampled. The ADC conversion rate is shared between all enabled channels. The internal temperature sensor is sampled, filtered and calibrated like the analog inputs when Temperature is enabled. By default all three analog inputs are enabled.")]
+        public AnalogChannels AnalogChannelEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogChannelEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogChannels GetPayload()
+        {
+            return AnalogChannelEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies which analog channels are sampled. The ADC conversion rate is shared between all enabled channels. The internal temperature sensor is sampled, filtered and calibrated like the analog inputs when Temperature is enabled. By default all three analog inputs are enabled.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogChannelEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogChannelEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies which analog channels are sampled. The ADC conversion rate is shared between all enabled channels. The internal temperature sensor is sampled, filtered and calibrated like the analog inputs when Temperature is enabled. By default all three analog inputs are enabled.
+    /// </summary>
+    [DisplayName("TimestampedAnalogChannelEnablePayload")]
+    [Description("Creates a timestamped message payload that specifies which analog channels are sampled. The ADC conversion rate is shared between all enabled channels. The internal temperature sensor is sampled, filtered and calibrated like the analog inputs when Temperature is enabled. By default all three analog inputs are enabled.")]
+    public partial class CreateTimestampedAnalogChannelEnablePayload : CreateAnalogChannelEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies which analog channels are sampled. The ADC conversion rate is shared between all enabled channels. The internal temperature sensor is sampled, filtered and calibrated like the analog inputs when Temperature is enabled. By default all three analog inputs are enabled.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogChannelEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogChannelEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the number of analog frames dropped because the device could not send them to the host in time.
+    /// </summary>
+    [DisplayName("AnalogOverrunPayload")]
+    [Description("Creates a message payload that reports the number of analog frames dropped because the device could not send them to the host in time.")]
+    public partial class CreateAnalogOverrunPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the number of analog frames dropped because the device could not send them to the host in time.
+        /// </summary>
+        [Description("The value that reports the number of analog frames dropped because the device could not send them to the host in time.")]
+        public uint AnalogOverrun { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogOverrun register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return AnalogOverrun;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the number of analog frames dropped because the device could not send them to the host in time.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogOverrun register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogOverrun.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the number of analog frames dropped because the device could not send them to the host in time.
+    /// </summary>
+    [DisplayName("TimestampedAnalogOverrunPayload")]
+    [Description("Creates a timestamped message payload that reports the number of analog frames dropped because the device could not send them to the host in time.")]
+    public partial class CreateTimestampedAnalogOverrunPayload : CreateAnalogOverrunPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the number of analog frames dropped because the device could not send them to the host in time.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogOverrun register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogOverrun.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies which analog channels are evaluated for threshold crossings on every ADC conversion.
+    /// </summary>
+    [DisplayName("AnalogThresholdEnablePayload")]
+    [Description("Creates a message payload that specifies which analog channels are evaluated for threshold crossings on every ADC conversion.")]
+    public partial class CreateAnalogThresholdEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies which analog channels are evaluated for threshold crossings on every ADC conversion.
+        /// </summary>
+        [Description("The value that specifies which analog channels are evaluated for threshold crossings on every ADC conversion.")]
+        public AnalogChannels AnalogThresholdEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogThresholdEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogChannels GetPayload()
+        {
+            return AnalogThresholdEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies which analog channels are evaluated for threshold crossings on every ADC conversion.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogThresholdEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogThresholdEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies which analog channels are evaluated for threshold crossings on every ADC conversion.
+    /// </summary>
+    [DisplayName("TimestampedAnalogThresholdEnablePayload")]
+    [Description("Creates a timestamped message payload that specifies which analog channels are evaluated for threshold crossings on every ADC conversion.")]
+    public partial class CreateTimestampedAnalogThresholdEnablePayload : CreateAnalogThresholdEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies which analog channels are evaluated for threshold crossings on every ADC conversion.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogThresholdEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogThresholdEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the level at or above which each analog channel is considered above threshold.
+    /// </summary>
+    [DisplayName("AnalogThresholdPayload")]
+    [Description("Creates a message payload that specifies the level at or above which each analog channel is considered above threshold.")]
+    public partial class CreateAnalogThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 0.
+        /// </summary>
+        [Description("The value for ADC channel 0.")]
+        public ushort AnalogInput0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 1.
+        /// </summary>
+        [Description("The value for ADC channel 1.")]
+        public ushort AnalogInput1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 2.
+        /// </summary>
+        [Description("The value for ADC channel 2.")]
+        public ushort AnalogInput2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for the internal temperature sensor.
+        /// </summary>
+        [Description("The value for the internal temperature sensor.")]
+        public ushort Temperature { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogThresholdPayload GetPayload()
+        {
+            AnalogThresholdPayload value;
+            value.AnalogInput0 = AnalogInput0;
+            value.AnalogInput1 = AnalogInput1;
+            value.AnalogInput2 = AnalogInput2;
+            value.Temperature = Temperature;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the level at or above which each analog channel is considered above threshold.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the level at or above which each analog channel is considered above threshold.
+    /// </summary>
+    [DisplayName("TimestampedAnalogThresholdPayload")]
+    [Description("Creates a timestamped message payload that specifies the level at or above which each analog channel is considered above threshold.")]
+    public partial class CreateTimestampedAnalogThresholdPayload : CreateAnalogThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the level at or above which each analog channel is considered above threshold.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies how far below the threshold each analog channel must fall before it is considered below threshold again.
+    /// </summary>
+    [DisplayName("AnalogHysteresisPayload")]
+    [Description("Creates a message payload that specifies how far below the threshold each analog channel must fall before it is considered below threshold again.")]
+    public partial class CreateAnalogHysteresisPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 0.
+        /// </summary>
+        [Description("The value for ADC channel 0.")]
+        public ushort AnalogInput0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 1.
+        /// </summary>
+        [Description("The value for ADC channel 1.")]
+        public ushort AnalogInput1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 2.
+        /// </summary>
+        [Description("The value for ADC channel 2.")]
+        public ushort AnalogInput2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for the internal temperature sensor.
+        /// </summary>
+        [Description("The value for the internal temperature sensor.")]
+        public ushort Temperature { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogHysteresis register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogHysteresisPayload GetPayload()
+        {
+            AnalogHysteresisPayload value;
+            value.AnalogInput0 = AnalogInput0;
+            value.AnalogInput1 = AnalogInput1;
+            value.AnalogInput2 = AnalogInput2;
+            value.Temperature = Temperature;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies how far below the threshold each analog channel must fall before it is considered below threshold again.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogHysteresis register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogHysteresis.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies how far below the threshold each analog channel must fall before it is considered below threshold again.
+    /// </summary>
+    [DisplayName("TimestampedAnalogHysteresisPayload")]
+    [Description("Creates a timestamped message payload that specifies how far below the threshold each analog channel must fall before it is considered below threshold again.")]
+    public partial class CreateTimestampedAnalogHysteresisPayload : CreateAnalogHysteresisPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies how far below the threshold each analog channel must fall before it is considered below threshold again.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogHysteresis register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogHysteresis.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports which enabled analog channels are above threshold whenever any of them crosses its threshold. The message timestamp is the sample time of the conversion which caused the crossing.
+    /// </summary>
+    [DisplayName("AnalogThresholdCrossingPayload")]
+    [Description("Creates a message payload that reports which enabled analog channels are above threshold whenever any of them crosses its threshold. The message timestamp is the sample time of the conversion which caused the crossing.")]
+    public partial class CreateAnalogThresholdCrossingPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports which enabled analog channels are above threshold whenever any of them crosses its threshold. The message timestamp is the sample time of the conversion which caused the crossing.
+        /// </summary>
+        [Description("The value that reports which enabled analog channels are above threshold whenever any of them crosses its threshold. The message timestamp is the sample time of the conversion which caused the crossing.")]
+        public AnalogChannels AnalogThresholdCrossing { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogThresholdCrossing register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogChannels GetPayload()
+        {
+            return AnalogThresholdCrossing;
+        }
+
+        /// <summary>
+        /// Creates a message that reports which enabled analog channels are above threshold whenever any of them crosses its threshold. The message timestamp is the sample time of the conversion which caused the crossing.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogThresholdCrossing register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogThresholdCrossing.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports which enabled analog channels are above threshold whenever any of them crosses its threshold. The message timestamp is the sample time of the conversion which caused the crossing.
+    /// </summary>
+    [DisplayName("TimestampedAnalogThresholdCrossingPayload")]
+    [Description("Creates a timestamped message payload that reports which enabled analog channels are above threshold whenever any of them crosses its threshold. The message timestamp is the sample time of the conversion which caused the crossing.")]
+    public partial class CreateTimestampedAnalogThresholdCrossingPayload : CreateAnalogThresholdCrossingPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports which enabled analog channels are above threshold whenever any of them crosses its threshold. The message timestamp is the sample time of the conversion which caused the crossing.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogThresholdCrossing register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogThresholdCrossing.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies whether analog frames are reported in the AnalogData or AnalogDataBatch registers. Disable to report only threshold crossings. Enabled by default.
+    /// </summary>
+    [DisplayName("AnalogDataEnablePayload")]
+    [Description("Creates a message payload that specifies whether analog frames are reported in the AnalogData or AnalogDataBatch registers. Disable to report only threshold crossings. Enabled by default.")]
+    public partial class CreateAnalogDataEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies whether analog frames are reported in the AnalogData or AnalogDataBatch registers. Disable to report only threshold crossings. Enabled by default.
+        /// </summary>
+        [Description("The value that specifies whether analog frames are reported in the AnalogData or AnalogDataBatch registers. Disable to report only threshold crossings. Enabled by default.")]
+        public EnableFlag AnalogDataEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogDataEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return AnalogDataEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies whether analog frames are reported in the AnalogData or AnalogDataBatch registers. Disable to report only threshold crossings. Enabled by default.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogDataEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies whether analog frames are reported in the AnalogData or AnalogDataBatch registers. Disable to report only threshold crossings. Enabled by default.
+    /// </summary>
+    [DisplayName("TimestampedAnalogDataEnablePayload")]
+    [Description("Creates a timestamped message payload that specifies whether analog frames are reported in the AnalogData or AnalogDataBatch registers. Disable to report only threshold crossings. Enabled by default.")]
+    public partial class CreateTimestampedAnalogDataEnablePayload : CreateAnalogDataEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies whether analog frames are reported in the AnalogData or AnalogDataBatch registers. Disable to report only threshold crossings. Enabled by default.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogDataEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the action applied by the firmware to the digital outputs when each analog channel crosses its threshold. Active reflexes shorten the ADC processing period to reduce reaction latency.
+    /// </summary>
+    [DisplayName("AnalogReflexActionPayload")]
+    [Description("Creates a message payload that specifies the action applied by the firmware to the digital outputs when each analog channel crosses its threshold. Active reflexes shorten the ADC processing period to reduce reaction latency.")]
+    public partial class CreateAnalogReflexActionPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the reflex action for ADC channel 0.
+        /// </summary>
+        [Description("The reflex action for ADC channel 0.")]
+        public ReflexAction AnalogInput0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the reflex action for ADC channel 1.
+        /// </summary>
+        [Description("The reflex action for ADC channel 1.")]
+        public ReflexAction AnalogInput1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the reflex action for ADC channel 2.
+        /// </summary>
+        [Description("The reflex action for ADC channel 2.")]
+        public ReflexAction AnalogInput2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the reflex action for the internal temperature sensor.
+        /// </summary>
+        [Description("The reflex action for the internal temperature sensor.")]
+        public ReflexAction Temperature { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogReflexAction register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogReflexActionPayload GetPayload()
+        {
+            AnalogReflexActionPayload value;
+            value.AnalogInput0 = AnalogInput0;
+            value.AnalogInput1 = AnalogInput1;
+            value.AnalogInput2 = AnalogInput2;
+            value.Temperature = Temperature;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the action applied by the firmware to the digital outputs when each analog channel crosses its threshold. Active reflexes shorten the ADC processing period to reduce reaction latency.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogReflexAction register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogReflexAction.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the action applied by the firmware to the digital outputs when each analog channel crosses its threshold. Active reflexes shorten the ADC processing period to reduce reaction latency.
+    /// </summary>
+    [DisplayName("TimestampedAnalogReflexActionPayload")]
+    [Description("Creates a timestamped message payload that specifies the action applied by the firmware to the digital outputs when each analog channel crosses its threshold. Active reflexes shorten the ADC processing period to reduce reaction latency.")]
+    public partial class CreateTimestampedAnalogReflexActionPayload : CreateAnalogReflexActionPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the action applied by the firmware to the digital outputs when each analog channel crosses its threshold. Active reflexes shorten the ADC processing period to reduce reaction latency.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogReflexAction register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogReflexAction.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital output lines driven by the reflex action of each analog channel.
+    /// </summary>
+    [DisplayName("AnalogReflexOutputPayload")]
+    [Description("Creates a message payload that specifies the digital output lines driven by the reflex action of each analog channel.")]
+    public partial class CreateAnalogReflexOutputPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the digital output lines driven by ADC channel 0.
+        /// </summary>
+        [Description("The digital output lines driven by ADC channel 0.")]
+        public DigitalOutputs AnalogInput0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the digital output lines driven by ADC channel 1.
+        /// </summary>
+        [Description("The digital output lines driven by ADC channel 1.")]
+        public DigitalOutputs AnalogInput1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the digital output lines driven by ADC channel 2.
+        /// </summary>
+        [Description("The digital output lines driven by ADC channel 2.")]
+        public DigitalOutputs AnalogInput2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the digital output lines driven by the internal temperature sensor.
+        /// </summary>
+        [Description("The digital output lines driven by the internal temperature sensor.")]
+        public DigitalOutputs Temperature { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogReflexOutput register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogReflexOutputPayload GetPayload()
+        {
+            AnalogReflexOutputPayload value;
+            value.AnalogInput0 = AnalogInput0;
+            value.AnalogInput1 = AnalogInput1;
+            value.AnalogInput2 = AnalogInput2;
+            value.Temperature = Temperature;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital output lines driven by the reflex action of each analog channel.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogReflexOutput register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogReflexOutput.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital output lines driven by the reflex action of each analog channel.
+    /// </summary>
+    [DisplayName("TimestampedAnalogReflexOutputPayload")]
+    [Description("Creates a timestamped message payload that specifies the digital output lines driven by the reflex action of each analog channel.")]
+    public partial class CreateTimestampedAnalogReflexOutputPayload : CreateAnalogReflexOutputPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital output lines driven by the reflex action of each analog channel.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogReflexOutput register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogReflexOutput.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the pulse train started by the PulseTrain reflex action.
+    /// </summary>
+    [DisplayName("AnalogReflexPulseTrainPayload")]
+    [Description("Creates a message payload that specifies the pulse train started by the PulseTrain reflex action.")]
+    public partial class CreateAnalogReflexPulseTrainPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the duration in microseconds that each pulse is HIGH.
+        /// </summary>
+        [Description("Specifies the duration in microseconds that each pulse is HIGH.")]
+        public uint PulseWidth { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the interval in microseconds between each pulse in the pulse train.
+        /// </summary>
+        [Description("Specifies the interval in microseconds between each pulse in the pulse train.")]
+        public uint PulsePeriod { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the number of pulses in the pulse train. A value of zero signifies an infinite pulse train.
+        /// </summary>
+        [Description("Specifies the number of pulses in the pulse train. A value of zero signifies an infinite pulse train.")]
+        public uint PulseCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogReflexPulseTrain register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogReflexPulseTrainPayload GetPayload()
+        {
+            AnalogReflexPulseTrainPayload value;
+            value.PulseWidth = PulseWidth;
+            value.PulsePeriod = PulsePeriod;
+            value.PulseCount = PulseCount;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the pulse train started by the PulseTrain reflex action.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogReflexPulseTrain register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogReflexPulseTrain.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the pulse train started by the PulseTrain reflex action.
+    /// </summary>
+    [DisplayName("TimestampedAnalogReflexPulseTrainPayload")]
+    [Description("Creates a timestamped message payload that specifies the pulse train started by the PulseTrain reflex action.")]
+    public partial class CreateTimestampedAnalogReflexPulseTrainPayload : CreateAnalogReflexPulseTrainPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the pulse train started by the PulseTrain reflex action.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogReflexPulseTrain register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogReflexPulseTrain.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the source which triggers a capture of all enabled analog channels at the full ADC conversion rate.
+    /// </summary>
+    [DisplayName("AnalogCaptureTriggerPayload")]
+    [Description("Creates a message payload that specifies the source which triggers a capture of all enabled analog channels at the full ADC conversion rate.")]
+    public partial class CreateAnalogCaptureTriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the source which triggers a capture of all enabled analog channels at the full ADC conversion rate.
+        /// </summary>
+        [Description("The value that specifies the source which triggers a capture of all enabled analog channels at the full ADC conversion rate.")]
+        public CaptureTrigger AnalogCaptureTrigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogCaptureTrigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public CaptureTrigger GetPayload()
+        {
+            return AnalogCaptureTrigger;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the source which triggers a capture of all enabled analog channels at the full ADC conversion rate.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogCaptureTrigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCaptureTrigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the source which triggers a capture of all enabled analog channels at the full ADC conversion rate.
+    /// </summary>
+    [DisplayName("TimestampedAnalogCaptureTriggerPayload")]
+    [Description("Creates a timestamped message payload that specifies the source which triggers a capture of all enabled analog channels at the full ADC conversion rate.")]
+    public partial class CreateTimestampedAnalogCaptureTriggerPayload : CreateAnalogCaptureTriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the source which triggers a capture of all enabled analog channels at the full ADC conversion rate.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogCaptureTrigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCaptureTrigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital input lines whose rising edge triggers a capture when AnalogCaptureTrigger is set to DigitalInput.
+    /// </summary>
+    [DisplayName("AnalogCaptureDigitalInputPayload")]
+    [Description("Creates a message payload that specifies the digital input lines whose rising edge triggers a capture when AnalogCaptureTrigger is set to DigitalInput.")]
+    public partial class CreateAnalogCaptureDigitalInputPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital input lines whose rising edge triggers a capture when AnalogCaptureTrigger is set to DigitalInput.
+        /// </summary>
+        [Description("The value that specifies the digital input lines whose rising edge triggers a capture when AnalogCaptureTrigger is set to DigitalInput.")]
+        public DigitalInputs AnalogCaptureDigitalInput { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogCaptureDigitalInput register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return AnalogCaptureDigitalInput;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital input lines whose rising edge triggers a capture when AnalogCaptureTrigger is set to DigitalInput.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogCaptureDigitalInput register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCaptureDigitalInput.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital input lines whose rising edge triggers a capture when AnalogCaptureTrigger is set to DigitalInput.
+    /// </summary>
+    [DisplayName("TimestampedAnalogCaptureDigitalInputPayload")]
+    [Description("Creates a timestamped message payload that specifies the digital input lines whose rising edge triggers a capture when AnalogCaptureTrigger is set to DigitalInput.")]
+    public partial class CreateTimestampedAnalogCaptureDigitalInputPayload : CreateAnalogCaptureDigitalInputPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital input lines whose rising edge triggers a capture when AnalogCaptureTrigger is set to DigitalInput.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogCaptureDigitalInput register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCaptureDigitalInput.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the capture window around the trigger, in scans of all enabled analog channels. The whole window can hold at most 4096 conversions.
+    /// </summary>
+    [DisplayName("AnalogCaptureWindowPayload")]
+    [Description("Creates a message payload that specifies the capture window around the trigger, in scans of all enabled analog channels. The whole window can hold at most 4096 conversions.")]
+    public partial class CreateAnalogCaptureWindowPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the number of scans recorded before the trigger.
+        /// </summary>
+        [Range(min: 0, max: 4096)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Specifies the number of scans recorded before the trigger.")]
+        public ushort PreTrigger { get; set; } = 100;
+
+        /// <summary>
+        /// Gets or sets a value that specifies the number of scans recorded after the trigger, including the scan containing the trigger.
+        /// </summary>
+        [Range(min: 0, max: 4096)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Specifies the number of scans recorded after the trigger, including the scan containing the trigger.")]
+        public ushort PostTrigger { get; set; } = 900;
+
+        /// <summary>
+        /// Creates a message payload for the AnalogCaptureWindow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogCaptureWindowPayload GetPayload()
+        {
+            AnalogCaptureWindowPayload value;
+            value.PreTrigger = PreTrigger;
+            value.PostTrigger = PostTrigger;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the capture window around the trigger, in scans of all enabled analog channels. The whole window can hold at most 4096 conversions.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogCaptureWindow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCaptureWindow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the capture window around the trigger, in scans of all enabled analog channels. The whole window can hold at most 4096 conversions.
+    /// </summary>
+    [DisplayName("TimestampedAnalogCaptureWindowPayload")]
+    [Description("Creates a timestamped message payload that specifies the capture window around the trigger, in scans of all enabled analog channels. The whole window can hold at most 4096 conversions.")]
+    public partial class CreateTimestampedAnalogCaptureWindowPayload : CreateAnalogCaptureWindowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the capture window around the trigger, in scans of all enabled analog channels. The whole window can hold at most 4096 conversions.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogCaptureWindow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCaptureWindow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports a chunk of a triggered capture with interleaved raw conversions of the enabled channels. The message timestamp is the sample time of the first scan in the chunk, and each subsequent scan follows at the ADC conversion rate.
+    /// </summary>
+    [DisplayName("AnalogCaptureDataPayload")]
+    [Description("Creates a message payload that reports a chunk of a triggered capture with interleaved raw conversions of the enabled channels. The message timestamp is the sample time of the first scan in the chunk, and each subsequent scan follows at the ADC conversion rate.")]
+    public partial class CreateAnalogCaptureDataPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports a chunk of a triggered capture with interleaved raw conversions of the enabled channels. The message timestamp is the sample time of the first scan in the chunk, and each subsequent scan follows at the ADC conversion rate.
+        /// </summary>
+        [Description("The value that reports a chunk of a triggered capture with interleaved raw conversions of the enabled channels. The message timestamp is the sample time of the first scan in the chunk, and each subsequent scan follows at the ADC conversion rate.")]
+        public ushort[] AnalogCaptureData { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogCaptureData register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return AnalogCaptureData;
+        }
+
+        /// <summary>
+        /// Creates a message that reports a chunk of a triggered capture with interleaved raw conversions of the enabled channels. The message timestamp is the sample time of the first scan in the chunk, and each subsequent scan follows at the ADC conversion rate.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogCaptureData register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCaptureData.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports a chunk of a triggered capture with interleaved raw conversions of the enabled channels. The message timestamp is the sample time of the first scan in the chunk, and each subsequent scan follows at the ADC conversion rate.
+    /// </summary>
+    [DisplayName("TimestampedAnalogCaptureDataPayload")]
+    [Description("Creates a timestamped message payload that reports a chunk of a triggered capture with interleaved raw conversions of the enabled channels. The message timestamp is the sample time of the first scan in the chunk, and each subsequent scan follows at the ADC conversion rate.")]
+    public partial class CreateTimestampedAnalogCaptureDataPayload : CreateAnalogCaptureDataPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports a chunk of a triggered capture with interleaved raw conversions of the enabled channels. The message timestamp is the sample time of the first scan in the chunk, and each subsequent scan follows at the ADC conversion rate.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogCaptureData register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCaptureData.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the delay, in microseconds, between enabling events and starting analog acquisition.
+    /// </summary>
+    [DisplayName("AnalogStartDelayPayload")]
+    [Description("Creates a message payload that specifies the delay, in microseconds, between enabling events and starting analog acquisition.")]
+    public partial class CreateAnalogStartDelayPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the delay, in microseconds, between enabling events and starting analog acquisition.
+        /// </summary>
+        [Range(min: 0, max: 10000000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that specifies the delay, in microseconds, between enabling events and starting analog acquisition.")]
+        public uint AnalogStartDelay { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the AnalogStartDelay register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return AnalogStartDelay;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the delay, in microseconds, between enabling events and starting analog acquisition.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogStartDelay register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogStartDelay.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the delay, in microseconds, between enabling events and starting analog acquisition.
+    /// </summary>
+    [DisplayName("TimestampedAnalogStartDelayPayload")]
+    [Description("Creates a timestamped message payload that specifies the delay, in microseconds, between enabling events and starting analog acquisition.")]
+    public partial class CreateTimestampedAnalogStartDelayPayload : CreateAnalogStartDelayPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the delay, in microseconds, between enabling events and starting analog acquisition.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogStartDelay register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogStartDelay.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the time, in microseconds, from enabling analog acquisition until the first frame is available on the device. The message timestamp is the sample time of the first frame.
+    /// </summary>
+    [DisplayName("AnalogStartLatencyPayload")]
+    [Description("Creates a message payload that reports the time, in microseconds, from enabling analog acquisition until the first frame is available on the device. The message timestamp is the sample time of the first frame.")]
+    public partial class CreateAnalogStartLatencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the time, in microseconds, from enabling analog acquisition until the first frame is available on the device. The message timestamp is the sample time of the first frame.
+        /// </summary>
+        [Description("The value that reports the time, in microseconds, from enabling analog acquisition until the first frame is available on the device. The message timestamp is the sample time of the first frame.")]
+        public uint AnalogStartLatency { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogStartLatency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return AnalogStartLatency;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the time, in microseconds, from enabling analog acquisition until the first frame is available on the device. The message timestamp is the sample time of the first frame.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogStartLatency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogStartLatency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the time, in microseconds, from enabling analog acquisition until the first frame is available on the device. The message timestamp is the sample time of the first frame.
+    /// </summary>
+    [DisplayName("TimestampedAnalogStartLatencyPayload")]
+    [Description("Creates a timestamped message payload that reports the time, in microseconds, from enabling analog acquisition until the first frame is available on the device. The message timestamp is the sample time of the first frame.")]
+    public partial class CreateTimestampedAnalogStartLatencyPayload : CreateAnalogStartLatencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the time, in microseconds, from enabling analog acquisition until the first frame is available on the device. The message timestamp is the sample time of the first frame.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogStartLatency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogStartLatency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies whether each analog frame is reported as the minimum, maximum and mean of every enabled channel over the frame window, in the AnalogStatistics register.
+    /// </summary>
+    [DisplayName("AnalogStatisticsEnablePayload")]
+    [Description("Creates a message payload that specifies whether each analog frame is reported as the minimum, maximum and mean of every enabled channel over the frame window, in the AnalogStatistics register.")]
+    public partial class CreateAnalogStatisticsEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies whether each analog frame is reported as the minimum, maximum and mean of every enabled channel over the frame window, in the AnalogStatistics register.
+        /// </summary>
+        [Description("The value that specifies whether each analog frame is reported as the minimum, maximum and mean of every enabled channel over the frame window, in the AnalogStatistics register.")]
+        public EnableFlag AnalogStatisticsEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogStatisticsEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return AnalogStatisticsEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies whether each analog frame is reported as the minimum, maximum and mean of every enabled channel over the frame window, in the AnalogStatistics register.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogStatisticsEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogStatisticsEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies whether each analog frame is reported as the minimum, maximum and mean of every enabled channel over the frame window, in the AnalogStatistics register.
+    /// </summary>
+    [DisplayName("TimestampedAnalogStatisticsEnablePayload")]
+    [Description("Creates a timestamped message payload that specifies whether each analog frame is reported as the minimum, maximum and mean of every enabled channel over the frame window, in the AnalogStatistics register.")]
+    public partial class CreateTimestampedAnalogStatisticsEnablePayload : CreateAnalogStatisticsEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies whether each analog frame is reported as the minimum, maximum and mean of every enabled channel over the frame window, in the AnalogStatistics register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogStatisticsEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogStatisticsEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the minimum, maximum and mean of the conversions of each enabled channel over a frame window, after the biquad filter and calibration are applied and before decimation, interleaved in ascending channel order. The message timestamp is the sample time of the first conversion in the window.
+    /// </summary>
+    [DisplayName("AnalogStatisticsPayload")]
+    [Description("Creates a message payload that reports the minimum, maximum and mean of the conversions of each enabled channel over a frame window, after the biquad filter and calibration are applied and before decimation, interleaved in ascending channel order. The message timestamp is the sample time of the first conversion in the window.")]
+    public partial class CreateAnalogStatisticsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the minimum, maximum and mean of the conversions of each enabled channel over a frame window, after the biquad filter and calibration are applied and before decimation, interleaved in ascending channel order. The message timestamp is the sample time of the first conversion in the window.
+        /// </summary>
+        [Description("The value that reports the minimum, maximum and mean of the conversions of each enabled channel over a frame window, after the biquad filter and calibration are applied and before decimation, interleaved in ascending channel order. The message timestamp is the sample time of the first conversion in the window.")]
+        public ushort[] AnalogStatistics { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogStatistics register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return AnalogStatistics;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the minimum, maximum and mean of the conversions of each enabled channel over a frame window, after the biquad filter and calibration are applied and before decimation, interleaved in ascending channel order. The message timestamp is the sample time of the first conversion in the window.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogStatistics register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogStatistics.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the minimum, maximum and mean of the conversions of each enabled channel over a frame window, after the biquad filter and calibration are applied and before decimation, interleaved in ascending channel order. The message timestamp is the sample time of the first conversion in the window.
+    /// </summary>
+    [DisplayName("TimestampedAnalogStatisticsPayload")]
+    [Description("Creates a timestamped message payload that reports the minimum, maximum and mean of the conversions of each enabled channel over a frame window, after the biquad filter and calibration are applied and before decimation, interleaved in ascending channel order. The message timestamp is the sample time of the first conversion in the window.")]
+    public partial class CreateTimestampedAnalogStatisticsPayload : CreateAnalogStatisticsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the minimum, maximum and mean of the conversions of each enabled channel over a frame window, after the biquad filter and calibration are applied and before decimation, interleaved in ascending channel order. The message timestamp is the sample time of the first conversion in the window.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogStatistics register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogStatistics.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the offset added to every raw conversion of each analog channel before applying the calibration gain.
+    /// </summary>
+    [DisplayName("AnalogCalibrationOffsetPayload")]
+    [Description("Creates a message payload that specifies the offset added to every raw conversion of each analog channel before applying the calibration gain.")]
+    public partial class CreateAnalogCalibrationOffsetPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 0.
+        /// </summary>
+        [Description("The value for ADC channel 0.")]
+        public short AnalogInput0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 1.
+        /// </summary>
+        [Description("The value for ADC channel 1.")]
+        public short AnalogInput1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 2.
+        /// </summary>
+        [Description("The value for ADC channel 2.")]
+        public short AnalogInput2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for the internal temperature sensor.
+        /// </summary>
+        [Description("The value for the internal temperature sensor.")]
+        public short Temperature { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogCalibrationOffset register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogCalibrationOffsetPayload GetPayload()
+        {
+            AnalogCalibrationOffsetPayload value;
+            value.AnalogInput0 = AnalogInput0;
+            value.AnalogInput1 = AnalogInput1;
+            value.AnalogInput2 = AnalogInput2;
+            value.Temperature = Temperature;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the offset added to every raw conversion of each analog channel before applying the calibration gain.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogCalibrationOffset register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCalibrationOffset.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the offset added to every raw conversion of each analog channel before applying the calibration gain.
+    /// </summary>
+    [DisplayName("TimestampedAnalogCalibrationOffsetPayload")]
+    [Description("Creates a timestamped message payload that specifies the offset added to every raw conversion of each analog channel before applying the calibration gain.")]
+    public partial class CreateTimestampedAnalogCalibrationOffsetPayload : CreateAnalogCalibrationOffsetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the offset added to every raw conversion of each analog channel before applying the calibration gain.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogCalibrationOffset register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCalibrationOffset.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the gain applied to every offset-corrected conversion of each analog channel, in Q14 fixed-point format where 16384 is unity gain.
+    /// </summary>
+    [DisplayName("AnalogCalibrationGainPayload")]
+    [Description("Creates a message payload that specifies the gain applied to every offset-corrected conversion of each analog channel, in Q14 fixed-point format where 16384 is unity gain.")]
+    public partial class CreateAnalogCalibrationGainPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 0.
+        /// </summary>
+        [Description("The value for ADC channel 0.")]
+        public ushort AnalogInput0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 1.
+        /// </summary>
+        [Description("The value for ADC channel 1.")]
+        public ushort AnalogInput1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 2.
+        /// </summary>
+        [Description("The value for ADC channel 2.")]
+        public ushort AnalogInput2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for the internal temperature sensor.
+        /// </summary>
+        [Description("The value for the internal temperature sensor.")]
+        public ushort Temperature { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogCalibrationGain register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogCalibrationGainPayload GetPayload()
+        {
+            AnalogCalibrationGainPayload value;
+            value.AnalogInput0 = AnalogInput0;
+            value.AnalogInput1 = AnalogInput1;
+            value.AnalogInput2 = AnalogInput2;
+            value.Temperature = Temperature;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the gain applied to every offset-corrected conversion of each analog channel, in Q14 fixed-point format where 16384 is unity gain.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogCalibrationGain register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCalibrationGain.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the gain applied to every offset-corrected conversion of each analog channel, in Q14 fixed-point format where 16384 is unity gain.
+    /// </summary>
+    [DisplayName("TimestampedAnalogCalibrationGainPayload")]
+    [Description("Creates a timestamped message payload that specifies the gain applied to every offset-corrected conversion of each analog channel, in Q14 fixed-point format where 16384 is unity gain.")]
+    public partial class CreateTimestampedAnalogCalibrationGainPayload : CreateAnalogCalibrationGainPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the gain applied to every offset-corrected conversion of each analog channel, in Q14 fixed-point format where 16384 is unity gain.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogCalibrationGain register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCalibrationGain.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that stores the current analog calibration in flash, loads the stored calibration, or clears the current calibration. The stored calibration is loaded on reset.
+    /// </summary>
+    [DisplayName("AnalogCalibrationCommandPayload")]
+    [Description("Creates a message payload that stores the current analog calibration in flash, loads the stored calibration, or clears the current calibration. The stored calibration is loaded on reset.")]
+    public partial class CreateAnalogCalibrationCommandPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that stores the current analog calibration in flash, loads the stored calibration, or clears the current calibration. The stored calibration is loaded on reset.
+        /// </summary>
+        [Description("The value that stores the current analog calibration in flash, loads the stored calibration, or clears the current calibration. The stored calibration is loaded on reset.")]
+        public CalibrationCommand AnalogCalibrationCommand { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogCalibrationCommand register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public CalibrationCommand GetPayload()
+        {
+            return AnalogCalibrationCommand;
+        }
+
+        /// <summary>
+        /// Creates a message that stores the current analog calibration in flash, loads the stored calibration, or clears the current calibration. The stored calibration is loaded on reset.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogCalibrationCommand register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCalibrationCommand.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that stores the current analog calibration in flash, loads the stored calibration, or clears the current calibration. The stored calibration is loaded on reset.
+    /// </summary>
+    [DisplayName("TimestampedAnalogCalibrationCommandPayload")]
+    [Description("Creates a timestamped message payload that stores the current analog calibration in flash, loads the stored calibration, or clears the current calibration. The stored calibration is loaded on reset.")]
+    public partial class CreateTimestampedAnalogCalibrationCommandPayload : CreateAnalogCalibrationCommandPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that stores the current analog calibration in flash, loads the stored calibration, or clears the current calibration. The stored calibration is loaded on reset.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogCalibrationCommand register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogCalibrationCommand.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the number of biquad filter sections, from zero to two, run on every conversion of each analog channel before calibration and decimation. Biquad sections can only run on enabled channels while the ADC conversion rate, AnalogSampleRate times AnalogDecimation times the number of enabled channels, is at most 100000 conversions per second. Writes exceeding this, to either this register or the analog configuration, are rejected.
+    /// </summary>
+    [DisplayName("AnalogBiquadSectionsPayload")]
+    [Description("Creates a message payload that specifies the number of biquad filter sections, from zero to two, run on every conversion of each analog channel before calibration and decimation. Biquad sections can only run on enabled channels while the ADC conversion rate, AnalogSampleRate times AnalogDecimation times the number of enabled channels, is at most 100000 conversions per second. Writes exceeding this, to either this register or the analog configuration, are rejected.")]
+    public partial class CreateAnalogBiquadSectionsPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 0.
+        /// </summary>
+        [Description("The value for ADC channel 0.")]
+        public byte AnalogInput0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 1.
+        /// </summary>
+        [Description("The value for ADC channel 1.")]
+        public byte AnalogInput1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for ADC channel 2.
+        /// </summary>
+        [Description("The value for ADC channel 2.")]
+        public byte AnalogInput2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the value for the internal temperature sensor.
+        /// </summary>
+        [Description("The value for the internal temperature sensor.")]
+        public byte Temperature { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogBiquadSections register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogBiquadSectionsPayload GetPayload()
+        {
+            AnalogBiquadSectionsPayload value;
+            value.AnalogInput0 = AnalogInput0;
+            value.AnalogInput1 = AnalogInput1;
+            value.AnalogInput2 = AnalogInput2;
+            value.Temperature = Temperature;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the number of biquad filter sections, from zero to two, run on every conversion of each analog channel before calibration and decimation. Biquad sections can only run on enabled channels while the ADC conversion rate, AnalogSampleRate times AnalogDecimation times the number of enabled channels, is at most 100000 conversions per second. Writes exceeding this, to either this register or the analog configuration, are rejected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogBiquadSections register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogBiquadSections.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the number of biquad filter sections, from zero to two, run on every conversion of each analog channel before calibration and decimation. Biquad sections can only run on enabled channels while the ADC conversion rate, AnalogSampleRate times AnalogDecimation times the number of enabled channels, is at most 100000 conversions per second. Writes exceeding this, to either this register or the analog configuration, are rejected.
+    /// </summary>
+    [DisplayName("TimestampedAnalogBiquadSectionsPayload")]
+    [Description("Creates a timestamped message payload that specifies the number of biquad filter sections, from zero to two, run on every conversion of each analog channel before calibration and decimation. Biquad sections can only run on enabled channels while the ADC conversion rate, AnalogSampleRate times AnalogDecimation times the number of enabled channels, is at most 100000 conversions per second. Writes exceeding this, to either this register or the analog configuration, are rejected.")]
+    public partial class CreateTimestampedAnalogBiquadSectionsPayload : CreateAnalogBiquadSectionsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the number of biquad filter sections, from zero to two, run on every conversion of each analog channel before calibration and decimation. Biquad sections can only run on enabled channels while the ADC conversion rate, AnalogSampleRate times AnalogDecimation times the number of enabled channels, is at most 100000 conversions per second. Writes exceeding this, to either this register or the analog configuration, are rejected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogBiquadSections register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogBiquadSections.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the biquad filter coefficients b0, b1, b2, a1 and a2 of each section, in Q30 fixed-point format, for ADC channels 0 to 2 and the temperature sensor in turn. Each section implements (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2).
+    /// </summary>
+    [DisplayName("AnalogBiquadCoefficientsPayload")]
+    [Description("Creates a message payload that specifies the biquad filter coefficients b0, b1, b2, a1 and a2 of each section, in Q30 fixed-point format, for ADC channels 0 to 2 and the temperature sensor in turn. Each section implements (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2).")]
+    public partial class CreateAnalogBiquadCoefficientsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the biquad filter coefficients b0, b1, b2, a1 and a2 of each section, in Q30 fixed-point format, for ADC channels 0 to 2 and the temperature sensor in turn. Each section implements (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2).
+        /// </summary>
+        [Description("The value that specifies the biquad filter coefficients b0, b1, b2, a1 and a2 of each section, in Q30 fixed-point format, for ADC channels 0 to 2 and the temperature sensor in turn. Each section implements (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2).")]
+        public int[] AnalogBiquadCoefficients { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogBiquadCoefficients register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int[] GetPayload()
+        {
+            return AnalogBiquadCoefficients;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the biquad filter coefficients b0, b1, b2, a1 and a2 of each section, in Q30 fixed-point format, for ADC channels 0 to 2 and the temperature sensor in turn. Each section implements (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogBiquadCoefficients register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogBiquadCoefficients.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the biquad filter coefficients b0, b1, b2, a1 and a2 of each section, in Q30 fixed-point format, for ADC channels 0 to 2 and the temperature sensor in turn. Each section implements (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2).
+    /// </summary>
+    [DisplayName("TimestampedAnalogBiquadCoefficientsPayload")]
+    [Description("Creates a timestamped message payload that specifies the biquad filter coefficients b0, b1, b2, a1 and a2 of each section, in Q30 fixed-point format, for ADC channels 0 to 2 and the temperature sensor in turn. Each section implements (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2).")]
+    public partial class CreateTimestampedAnalogBiquadCoefficientsPayload : CreateAnalogBiquadCoefficientsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the biquad filter coefficients b0, b1, b2, a1 and a2 of each section, in Q30 fixed-point format, for ADC channels 0 to 2 and the temperature sensor in turn. Each section implements (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogBiquadCoefficients register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogBiquadCoefficients.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the format used to report analog frames. In the packed format, frames and batches are reported in the AnalogDataPacked register. In the compressed format, frames are reported in the AnalogDataCompressed register, and a batch size of zero fills each message.
+    /// </summary>
+    [DisplayName("AnalogDataFormatPayload")]
+    [Description("Creates a message payload that specifies the format used to report analog frames. In the packed format, frames and batches are reported in the AnalogDataPacked register. In the compressed format, frames are reported in the AnalogDataCompressed register, and a batch size of zero fills each message.")]
+    public partial class CreateAnalogDataFormatPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the format used to report analog frames. In the packed format, frames and batches are reported in the AnalogDataPacked register. In the compressed format, frames are reported in the AnalogDataCompressed register, and a batch size of zero fills each message.
+        /// </summary>
+        [Description("The value that specifies the format used to report analog frames. In the packed format, frames and batches are reported in the AnalogDataPacked register. In the compressed format, frames are reported in the AnalogDataCompressed register, and a batch size of zero fills each message.")]
+        public AnalogDataFormat AnalogDataFormat { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogDataFormat register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogDataFormat GetPayload()
+        {
+            return AnalogDataFormat;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the format used to report analog frames. In the packed format, frames and batches are reported in the AnalogDataPacked register. In the compressed format, frames are reported in the AnalogDataCompressed register, and a batch size of zero fills each message.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogDataFormat register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataFormat.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the format used to report analog frames. In the packed format, frames and batches are reported in the AnalogDataPacked register. In the compressed format, frames are reported in the AnalogDataCompressed register, and a batch size of zero fills each message.
+    /// </summary>
+    [DisplayName("TimestampedAnalogDataFormatPayload")]
+    [Description("Creates a timestamped message payload that specifies the format used to report analog frames. In the packed format, frames and batches are reported in the AnalogDataPacked register. In the compressed format, frames are reported in the AnalogDataCompressed register, and a batch size of zero fills each message.")]
+    public partial class CreateTimestampedAnalogDataFormatPayload : CreateAnalogDataFormatPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the format used to report analog frames. In the packed format, frames and batches are reported in the AnalogDataPacked register. In the compressed format, frames are reported in the AnalogDataCompressed register, and a batch size of zero fills each message.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogDataFormat register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataFormat.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports a batch of consecutive analog frames with interleaved values of the enabled channels, packing two 12-bit values in every three bytes. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+    /// </summary>
+    [DisplayName("AnalogDataPackedPayload")]
+    [Description("Creates a message payload that reports a batch of consecutive analog frames with interleaved values of the enabled channels, packing two 12-bit values in every three bytes. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.")]
+    public partial class CreateAnalogDataPackedPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports a batch of consecutive analog frames with interleaved values of the enabled channels, packing two 12-bit values in every three bytes. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+        /// </summary>
+        [Description("The value that reports a batch of consecutive analog frames with interleaved values of the enabled channels, packing two 12-bit values in every three bytes. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.")]
+        public byte[] AnalogDataPacked { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogDataPacked register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return AnalogDataPacked;
+        }
+
+        /// <summary>
+        /// Creates a message that reports a batch of consecutive analog frames with interleaved values of the enabled channels, packing two 12-bit values in every three bytes. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogDataPacked register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataPacked.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports a batch of consecutive analog frames with interleaved values of the enabled channels, packing two 12-bit values in every three bytes. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+    /// </summary>
+    [DisplayName("TimestampedAnalogDataPackedPayload")]
+    [Description("Creates a timestamped message payload that reports a batch of consecutive analog frames with interleaved values of the enabled channels, packing two 12-bit values in every three bytes. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.")]
+    public partial class CreateTimestampedAnalogDataPackedPayload : CreateAnalogDataPackedPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports a batch of consecutive analog frames with interleaved values of the enabled channels, packing two 12-bit values in every three bytes. The message timestamp is the sample time of the first frame, and each subsequent frame follows at the interval set by AnalogSampleRate.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogDataPacked register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataPacked.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports a delta compressed batch of consecutive analog frames. The first byte is the number of enabled channels, followed by the first frame as little-endian 16-bit values. Each subsequent value is the difference from the previous value of the same channel, zig-zag encoded as a little-endian base-128 varint. The message timestamp is the sample time of the first frame.
+    /// </summary>
+    [DisplayName("AnalogDataCompressedPayload")]
+    [Description("Creates a message payload that reports a delta compressed batch of consecutive analog frames. The first byte is the number of enabled channels, followed by the first frame as little-endian 16-bit values. Each subsequent value is the difference from the previous value of the same channel, zig-zag encoded as a little-endian base-128 varint. The message timestamp is the sample time of the first frame.")]
+    public partial class CreateAnalogDataCompressedPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports a delta compressed batch of consecutive analog frames. The first byte is the number of enabled channels, followed by the first frame as little-endian 16-bit values. Each subsequent value is the difference from the previous value of the same channel, zig-zag encoded as a little-endian base-128 varint. The message timestamp is the sample time of the first frame.
+        /// </summary>
+        [Description("The value that reports a delta compressed batch of consecutive analog frames. The first byte is the number of enabled channels, followed by the first frame as little-endian 16-bit values. Each subsequent value is the difference from the previous value of the same channel, zig-zag encoded as a little-endian base-128 varint. The message timestamp is the sample time of the first frame.")]
+        public byte[] AnalogDataCompressed { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogDataCompressed register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte[] GetPayload()
+        {
+            return AnalogDataCompressed;
+        }
+
+        /// <summary>
+        /// Creates a message that reports a delta compressed batch of consecutive analog frames. The first byte is the number of enabled channels, followed by the first frame as little-endian 16-bit values. Each subsequent value is the difference from the previous value of the same channel, zig-zag encoded as a little-endian base-128 varint. The message timestamp is the sample time of the first frame.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogDataCompressed register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataCompressed.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports a delta compressed batch of consecutive analog frames. The first byte is the number of enabled channels, followed by the first frame as little-endian 16-bit values. Each subsequent value is the difference from the previous value of the same channel, zig-zag encoded as a little-endian base-128 varint. The message timestamp is the sample time of the first frame.
+    /// </summary>
+    [DisplayName("TimestampedAnalogDataCompressedPayload")]
+    [Description("Creates a timestamped message payload that reports a delta compressed batch of consecutive analog frames. The first byte is the number of enabled channels, followed by the first frame as little-endian 16-bit values. Each subsequent value is the difference from the previous value of the same channel, zig-zag encoded as a little-endian base-128 varint. The message timestamp is the sample time of the first frame.")]
+    public partial class CreateTimestampedAnalogDataCompressedPayload : CreateAnalogDataCompressedPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports a delta compressed batch of consecutive analog frames. The first byte is the number of enabled channels, followed by the first frame as little-endian 16-bit values. Each subsequent value is the difference from the previous value of the same channel, zig-zag encoded as a little-endian base-128 varint. The message timestamp is the sample time of the first frame.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogDataCompressed register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogDataCompressed.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the number of times acquisition was restarted to keep channels aligned after conversions were lost to an ADC FIFO overflow, or the DMA ring position no longer matched the conversions processed. The message timestamp is the sample time of the last conversion before the restart. Batches are never assembled across a restart or dropped frames, and are reported early instead.
+    /// </summary>
+    [DisplayName("AnalogResyncPayload")]
+    [Description("Creates a message payload that reports the number of times acquisition was restarted to keep channels aligned after conversions were lost to an ADC FIFO overflow, or the DMA ring position no longer matched the conversions processed. The message timestamp is the sample time of the last conversion before the restart. Batches are never assembled across a restart or dropped frames, and are reported early instead.")]
+    public partial class CreateAnalogResyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the number of times acquisition was restarted to keep channels aligned after conversions were lost to an ADC FIFO overflow, or the DMA ring position no longer matched the conversions processed. The message timestamp is the sample time of the last conversion before the restart. Batches are never assembled across a restart or dropped frames, and are reported early instead.
+        /// </summary>
+        [Description("The value that reports the number of times acquisition was restarted to keep channels aligned after conversions were lost to an ADC FIFO overflow, or the DMA ring position no longer matched the conversions processed. The message timestamp is the sample time of the last conversion before the restart. Batches are never assembled across a restart or dropped frames, and are reported early instead.")]
+        public uint AnalogResync { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogResync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return AnalogResync;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the number of times acquisition was restarted to keep channels aligned after conversions were lost to an ADC FIFO overflow, or the DMA ring position no longer matched the conversions processed. The message timestamp is the sample time of the last conversion before the restart. Batches are never assembled across a restart or dropped frames, and are reported early instead.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogResync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogResync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the number of times acquisition was restarted to keep channels aligned after conversions were lost to an ADC FIFO overflow, or the DMA ring position no longer matched the conversions processed. The message timestamp is the sample time of the last conversion before the restart. Batches are never assembled across a restart or dropped frames, and are reported early instead.
+    /// </summary>
+    [DisplayName("TimestampedAnalogResyncPayload")]
+    [Description("Creates a timestamped message payload that reports the number of times acquisition was restarted to keep channels aligned after conversions were lost to an ADC FIFO overflow, or the DMA ring position no longer matched the conversions processed. The message timestamp is the sample time of the last conversion before the restart. Batches are never assembled across a restart or dropped frames, and are reported early instead.")]
+    public partial class CreateTimestampedAnalogResyncPayload : CreateAnalogResyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the number of times acquisition was restarted to keep channels aligned after conversions were lost to an ADC FIFO overflow, or the DMA ring position no longer matched the conversions processed. The message timestamp is the sample time of the last conversion before the restart. Batches are never assembled across a restart or dropped frames, and are reported early instead.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogResync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogResync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital output lines whose pulse trains trigger pulse-locked analog sampling. Every pulse of a pulse train using any of the specified lines reports a scan in the AnalogPulseSample register.
+    /// </summary>
+    [DisplayName("AnalogPulseSampleOutputsPayload")]
+    [Description("Creates a message payload that specifies the digital output lines whose pulse trains trigger pulse-locked analog sampling. Every pulse of a pulse train using any of the specified lines reports a scan in the AnalogPulseSample register.")]
+    public partial class CreateAnalogPulseSampleOutputsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital output lines whose pulse trains trigger pulse-locked analog sampling. Every pulse of a pulse train using any of the specified lines reports a scan in the AnalogPulseSample register.
+        /// </summary>
+        [Description("The value that specifies the digital output lines whose pulse trains trigger pulse-locked analog sampling. Every pulse of a pulse train using any of the specified lines reports a scan in the AnalogPulseSample register.")]
+        public DigitalOutputs AnalogPulseSampleOutputs { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogPulseSampleOutputs register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return AnalogPulseSampleOutputs;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital output lines whose pulse trains trigger pulse-locked analog sampling. Every pulse of a pulse train using any of the specified lines reports a scan in the AnalogPulseSample register.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogPulseSampleOutputs register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogPulseSampleOutputs.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital output lines whose pulse trains trigger pulse-locked analog sampling. Every pulse of a pulse train using any of the specified lines reports a scan in the AnalogPulseSample register.
+    /// </summary>
+    [DisplayName("TimestampedAnalogPulseSampleOutputsPayload")]
+    [Description("Creates a timestamped message payload that specifies the digital output lines whose pulse trains trigger pulse-locked analog sampling. Every pulse of a pulse train using any of the specified lines reports a scan in the AnalogPulseSample register.")]
+    public partial class CreateTimestampedAnalogPulseSampleOutputsPayload : CreateAnalogPulseSampleOutputsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital output lines whose pulse trains trigger pulse-locked analog sampling. Every pulse of a pulse train using any of the specified lines reports a scan in the AnalogPulseSample register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogPulseSampleOutputs register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogPulseSampleOutputs.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the delay, in microseconds, from the rising edge of each pulse to the analog scan reported in the AnalogPulseSample register.
+    /// </summary>
+    [DisplayName("AnalogPulseSampleDelayPayload")]
+    [Description("Creates a message payload that specifies the delay, in microseconds, from the rising edge of each pulse to the analog scan reported in the AnalogPulseSample register.")]
+    public partial class CreateAnalogPulseSampleDelayPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the delay, in microseconds, from the rising edge of each pulse to the analog scan reported in the AnalogPulseSample register.
+        /// </summary>
+        [Range(min: 0, max: 1000000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that specifies the delay, in microseconds, from the rising edge of each pulse to the analog scan reported in the AnalogPulseSample register.")]
+        public uint AnalogPulseSampleDelay { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the AnalogPulseSampleDelay register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return AnalogPulseSampleDelay;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the delay, in microseconds, from the rising edge of each pulse to the analog scan reported in the AnalogPulseSample register.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogPulseSampleDelay register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogPulseSampleDelay.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the delay, in microseconds, from the rising edge of each pulse to the analog scan reported in the AnalogPulseSample register.
+    /// </summary>
+    [DisplayName("TimestampedAnalogPulseSampleDelayPayload")]
+    [Description("Creates a timestamped message payload that specifies the delay, in microseconds, from the rising edge of each pulse to the analog scan reported in the AnalogPulseSample register.")]
+    public partial class CreateTimestampedAnalogPulseSampleDelayPayload : CreateAnalogPulseSampleDelayPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the delay, in microseconds, from the rising edge of each pulse to the analog scan reported in the AnalogPulseSample register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogPulseSampleDelay register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogPulseSampleDelay.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the first scan of the enabled analog channels starting at the configured delay after a pulse. The payload holds the digital output lines of the pulse train, the zero-based index of the pulse in the train, and the calibrated values of the enabled channels in ascending channel order. The message timestamp is the sample time of the scan, which is resolved to the ADC conversion interval. Pulses whose scans cannot be reported are counted in AnalogPulseSampleOverrun.
+    /// </summary>
+    [DisplayName("AnalogPulseSamplePayload")]
+    [Description("Creates a message payload that reports the first scan of the enabled analog channels starting at the configured delay after a pulse. The payload holds the digital output lines of the pulse train, the zero-based index of the pulse in the train, and the calibrated values of the enabled channels in ascending channel order. The message timestamp is the sample time of the scan, which is resolved to the ADC conversion interval. Pulses whose scans cannot be reported are counted in AnalogPulseSampleOverrun.")]
+    public partial class CreateAnalogPulseSamplePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the first scan of the enabled analog channels starting at the configured delay after a pulse. The payload holds the digital output lines of the pulse train, the zero-based index of the pulse in the train, and the calibrated values of the enabled channels in ascending channel order. The message timestamp is the sample time of the scan, which is resolved to the ADC conversion interval. Pulses whose scans cannot be reported are counted in AnalogPulseSampleOverrun.
+        /// </summary>
+        [Description("The value that reports the first scan of the enabled analog channels starting at the configured delay after a pulse. The payload holds the digital output lines of the pulse train, the zero-based index of the pulse in the train, and the calibrated values of the enabled channels in ascending channel order. The message timestamp is the sample time of the scan, which is resolved to the ADC conversion interval. Pulses whose scans cannot be reported are counted in AnalogPulseSampleOverrun.")]
+        public uint[] AnalogPulseSample { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogPulseSample register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return AnalogPulseSample;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the first scan of the enabled analog channels starting at the configured delay after a pulse. The payload holds the digital output lines of the pulse train, the zero-based index of the pulse in the train, and the calibrated values of the enabled channels in ascending channel order. The message timestamp is the sample time of the scan, which is resolved to the ADC conversion interval. Pulses whose scans cannot be reported are counted in AnalogPulseSampleOverrun.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogPulseSample register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogPulseSample.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the first scan of the enabled analog channels starting at the configured delay after a pulse. The payload holds the digital output lines of the pulse train, the zero-based index of the pulse in the train, and the calibrated values of the enabled channels in ascending channel order. The message timestamp is the sample time of the scan, which is resolved to the ADC conversion interval. Pulses whose scans cannot be reported are counted in AnalogPulseSampleOverrun.
+    /// </summary>
+    [DisplayName("TimestampedAnalogPulseSamplePayload")]
+    [Description("Creates a timestamped message payload that reports the first scan of the enabled analog channels starting at the configured delay after a pulse. The payload holds the digital output lines of the pulse train, the zero-based index of the pulse in the train, and the calibrated values of the enabled channels in ascending channel order. The message timestamp is the sample time of the scan, which is resolved to the ADC conversion interval. Pulses whose scans cannot be reported are counted in AnalogPulseSampleOverrun.")]
+    public partial class CreateTimestampedAnalogPulseSamplePayload : CreateAnalogPulseSamplePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the first scan of the enabled analog channels starting at the configured delay after a pulse. The payload holds the digital output lines of the pulse train, the zero-based index of the pulse in the train, and the calibrated values of the enabled channels in ascending channel order. The message timestamp is the sample time of the scan, which is resolved to the ADC conversion interval. Pulses whose scans cannot be reported are counted in AnalogPulseSampleOverrun.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogPulseSample register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogPulseSample.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies whether each analog channel reports its amplitude envelope instead of its value. The envelope is computed on every conversion after removing a slowly tracked baseline, and averaged over each frame window, so AnalogDecimation sets the smoothing window at the reported rate.
+    /// </summary>
+    [DisplayName("AnalogEnvelopeModePayload")]
+    [Description("Creates a message payload that specifies whether each analog channel reports its amplitude envelope instead of its value. The envelope is computed on every conversion after removing a slowly tracked baseline, and averaged over each frame window, so AnalogDecimation sets the smoothing window at the reported rate.")]
+    public partial class CreateAnalogEnvelopeModePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the envelope mode for ADC channel 0.
+        /// </summary>
+        [Description("The envelope mode for ADC channel 0.")]
+        public EnvelopeMode AnalogInput0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the envelope mode for ADC channel 1.
+        /// </summary>
+        [Description("The envelope mode for ADC channel 1.")]
+        public EnvelopeMode AnalogInput1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the envelope mode for ADC channel 2.
+        /// </summary>
+        [Description("The envelope mode for ADC channel 2.")]
+        public EnvelopeMode AnalogInput2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the envelope mode for the internal temperature sensor.
+        /// </summary>
+        [Description("The envelope mode for the internal temperature sensor.")]
+        public EnvelopeMode Temperature { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogEnvelopeMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AnalogEnvelopeModePayload GetPayload()
+        {
+            AnalogEnvelopeModePayload value;
+            value.AnalogInput0 = AnalogInput0;
+            value.AnalogInput1 = AnalogInput1;
+            value.AnalogInput2 = AnalogInput2;
+            value.Temperature = Temperature;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies whether each analog channel reports its amplitude envelope instead of its value. The envelope is computed on every conversion after removing a slowly tracked baseline, and averaged over each frame window, so AnalogDecimation sets the smoothing window at the reported rate.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogEnvelopeMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogEnvelopeMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies whether each analog channel reports its amplitude envelope instead of its value. The envelope is computed on every conversion after removing a slowly tracked baseline, and averaged over each frame window, so AnalogDecimation sets the smoothing window at the reported rate.
+    /// </summary>
+    [DisplayName("TimestampedAnalogEnvelopeModePayload")]
+    [Description("Creates a timestamped message payload that specifies whether each analog channel reports its amplitude envelope instead of its value. The envelope is computed on every conversion after removing a slowly tracked baseline, and averaged over each frame window, so AnalogDecimation sets the smoothing window at the reported rate.")]
+    public partial class CreateTimestampedAnalogEnvelopeModePayload : CreateAnalogEnvelopeModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies whether each analog channel reports its amplitude envelope instead of its value. The envelope is computed on every conversion after removing a slowly tracked baseline, and averaged over each frame window, so AnalogDecimation sets the smoothing window at the reported rate.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogEnvelopeMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogEnvelopeMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the Harp time, in microseconds, at which the pulse train started by the next StartPulseTrain write emits its first rising edge. The value is cleared once it is used, and a value of zero starts the train immediately. Start times in the past are rejected by StartPulseTrain.
+    /// </summary>
+    [DisplayName("PulseTrainStartTimePayload")]
+    [Description("Creates a message payload that specifies the Harp time, in microseconds, at which the pulse train started by the next StartPulseTrain write emits its first rising edge. The value is cleared once it is used, and a value of zero starts the train immediately. Start times in the past are rejected by StartPulseTrain.")]
+    public partial class CreatePulseTrainStartTimePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the Harp time, in microseconds, at which the pulse train started by the next StartPulseTrain write emits its first rising edge. The value is cleared once it is used, and a value of zero starts the train immediately. Start times in the past are rejected by StartPulseTrain.
+        /// </summary>
+        [Description("The value that specifies the Harp time, in microseconds, at which the pulse train started by the next StartPulseTrain write emits its first rising edge. The value is cleared once it is used, and a value of zero starts the train immediately. Start times in the past are rejected by StartPulseTrain.")]
+        public ulong PulseTrainStartTime { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PulseTrainStartTime register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ulong GetPayload()
+        {
+            return PulseTrainStartTime;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the Harp time, in microseconds, at which the pulse train started by the next StartPulseTrain write emits its first rising edge. The value is cleared once it is used, and a value of zero starts the train immediately. Start times in the past are rejected by StartPulseTrain.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PulseTrainStartTime register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainStartTime.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the Harp time, in microseconds, at which the pulse train started by the next StartPulseTrain write emits its first rising edge. The value is cleared once it is used, and a value of zero starts the train immediately. Start times in the past are rejected by StartPulseTrain.
+    /// </summary>
+    [DisplayName("TimestampedPulseTrainStartTimePayload")]
+    [Description("Creates a timestamped message payload that specifies the Harp time, in microseconds, at which the pulse train started by the next StartPulseTrain write emits its first rising edge. The value is cleared once it is used, and a value of zero starts the train immediately. Start times in the past are rejected by StartPulseTrain.")]
+    public partial class CreateTimestampedPulseTrainStartTimePayload : CreatePulseTrainStartTimePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the Harp time, in microseconds, at which the pulse train started by the next StartPulseTrain write emits its first rising edge. The value is cleared once it is used, and a value of zero starts the train immediately. Start times in the past are rejected by StartPulseTrain.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PulseTrainStartTime register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainStartTime.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital output sequence played by StartOutputSequence, as up to 30 pairs of step duration in microseconds and digital output state. The sequence ends at the first step with zero duration. Steps are played by a PIO state machine fed by DMA, so changes take effect on the next start.
+    /// </summary>
+    [DisplayName("OutputSequencePayload")]
+    [Description("Creates a message payload that specifies the digital output sequence played by StartOutputSequence, as up to 30 pairs of step duration in microseconds and digital output state. The sequence ends at the first step with zero duration. Steps are played by a PIO state machine fed by DMA, so changes take effect on the next start.")]
+    public partial class CreateOutputSequencePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital output sequence played by StartOutputSequence, as up to 30 pairs of step duration in microseconds and digital output state. The sequence ends at the first step with zero duration. Steps are played by a PIO state machine fed by DMA, so changes take effect on the next start.
+        /// </summary>
+        [Description("The value that specifies the digital output sequence played by StartOutputSequence, as up to 30 pairs of step duration in microseconds and digital output state. The sequence ends at the first step with zero duration. Steps are played by a PIO state machine fed by DMA, so changes take effect on the next start.")]
+        public uint[] OutputSequence { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputSequence register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return OutputSequence;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital output sequence played by StartOutputSequence, as up to 30 pairs of step duration in microseconds and digital output state. The sequence ends at the first step with zero duration. Steps are played by a PIO state machine fed by DMA, so changes take effect on the next start.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputSequence register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.OutputSequence.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital output sequence played by StartOutputSequence, as up to 30 pairs of step duration in microseconds and digital output state. The sequence ends at the first step with zero duration. Steps are played by a PIO state machine fed by DMA, so changes take effect on the next start.
+    /// </summary>
+    [DisplayName("TimestampedOutputSequencePayload")]
+    [Description("Creates a timestamped message payload that specifies the digital output sequence played by StartOutputSequence, as up to 30 pairs of step duration in microseconds and digital output state. The sequence ends at the first step with zero duration. Steps are played by a PIO state machine fed by DMA, so changes take effect on the next start.")]
+    public partial class CreateTimestampedOutputSequencePayload : CreateOutputSequencePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital output sequence played by StartOutputSequence, as up to 30 pairs of step duration in microseconds and digital output state. The sequence ends at the first step with zero duration. Steps are played by a PIO state machine fed by DMA, so changes take effect on the next start.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputSequence register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.OutputSequence.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that starts playing the output sequence on the specified digital output lines, replacing any running sequence. The sequence stops any pulse train on the lines between its lowest and highest line, which are reported in StopPulseTrain, and starting a pulse train on those lines stops the sequence. Lines keep the state of the last step when the sequence ends.
+    /// </summary>
+    [DisplayName("StartOutputSequencePayload")]
+    [Description("Creates a message payload that starts playing the output sequence on the specified digital output lines, replacing any running sequence. The sequence stops any pulse train on the lines between its lowest and highest line, which are reported in StopPulseTrain, and starting a pulse train on those lines stops the sequence. Lines keep the state of the last step when the sequence ends.")]
+    public partial class CreateStartOutputSequencePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the digital output lines driven by the sequence.
+        /// </summary>
+        [Description("Specifies the digital output lines driven by the sequence.")]
+        public DigitalOutputs DigitalOutput { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that specifies the number of times the sequence is played. A value of zero plays the sequence until it is stopped.
+        /// </summary>
+        [Description("Specifies the number of times the sequence is played. A value of zero plays the sequence until it is stopped.")]
+        public byte LoopCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StartOutputSequence register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public StartOutputSequencePayload GetPayload()
+        {
+            StartOutputSequencePayload value;
+            value.DigitalOutput = DigitalOutput;
+            value.LoopCount = LoopCount;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that starts playing the output sequence on the specified digital output lines, replacing any running sequence. The sequence stops any pulse train on the lines between its lowest and highest line, which are reported in StopPulseTrain, and starting a pulse train on those lines stops the sequence. Lines keep the state of the last step when the sequence ends.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StartOutputSequence register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.StartOutputSequence.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that starts playing the output sequence on the specified digital output lines, replacing any running sequence. The sequence stops any pulse train on the lines between its lowest and highest line, which are reported in StopPulseTrain, and starting a pulse train on those lines stops the sequence. Lines keep the state of the last step when the sequence ends.
+    /// </summary>
+    [DisplayName("TimestampedStartOutputSequencePayload")]
+    [Description("Creates a timestamped message payload that starts playing the output sequence on the specified digital output lines, replacing any running sequence. The sequence stops any pulse train on the lines between its lowest and highest line, which are reported in StopPulseTrain, and starting a pulse train on those lines stops the sequence. Lines keep the state of the last step when the sequence ends.")]
+    public partial class CreateTimestampedStartOutputSequencePayload : CreateStartOutputSequencePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that starts playing the output sequence on the specified digital output lines, replacing any running sequence. The sequence stops any pulse train on the lines between its lowest and highest line, which are reported in StopPulseTrain, and starting a pulse train on those lines stops the sequence. Lines keep the state of the last step when the sequence ends.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StartOutputSequence register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.StartOutputSequence.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that stops the running output sequence when written with any value. Lines keep the state they were driven to.
+    /// </summary>
+    [DisplayName("StopOutputSequencePayload")]
+    [Description("Creates a message payload that stops the running output sequence when written with any value. Lines keep the state they were driven to.")]
+    public partial class CreateStopOutputSequencePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that stops the running output sequence when written with any value. Lines keep the state they were driven to.
+        /// </summary>
+        [Description("The value that stops the running output sequence when written with any value. Lines keep the state they were driven to.")]
+        public byte StopOutputSequence { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StopOutputSequence register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return StopOutputSequence;
+        }
+
+        /// <summary>
+        /// Creates a message that stops the running output sequence when written with any value. Lines keep the state they were driven to.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StopOutputSequence register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.StopOutputSequence.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that stops the running output sequence when written with any value. Lines keep the state they were driven to.
+    /// </summary>
+    [DisplayName("TimestampedStopOutputSequencePayload")]
+    [Description("Creates a timestamped message payload that stops the running output sequence when written with any value. Lines keep the state they were driven to.")]
+    public partial class CreateTimestampedStopOutputSequencePayload : CreateStopOutputSequencePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that stops the running output sequence when written with any value. Lines keep the state they were driven to.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StopOutputSequence register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.StopOutputSequence.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the digital output lines driven by the output sequence when it starts, and zero when it ends or is stopped.
+    /// </summary>
+    [DisplayName("OutputSequenceStatePayload")]
+    [Description("Creates a message payload that reports the digital output lines driven by the output sequence when it starts, and zero when it ends or is stopped.")]
+    public partial class CreateOutputSequenceStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the digital output lines driven by the output sequence when it starts, and zero when it ends or is stopped.
+        /// </summary>
+        [Description("The value that reports the digital output lines driven by the output sequence when it starts, and zero when it ends or is stopped.")]
+        public DigitalOutputs OutputSequenceState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputSequenceState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputSequenceState;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the digital output lines driven by the output sequence when it starts, and zero when it ends or is stopped.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputSequenceState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.OutputSequenceState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the digital output lines driven by the output sequence when it starts, and zero when it ends or is stopped.
+    /// </summary>
+    [DisplayName("TimestampedOutputSequenceStatePayload")]
+    [Description("Creates a timestamped message payload that reports the digital output lines driven by the output sequence when it starts, and zero when it ends or is stopped.")]
+    public partial class CreateTimestampedOutputSequenceStatePayload : CreateOutputSequenceStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the digital output lines driven by the output sequence when it starts, and zero when it ends or is stopped.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputSequenceState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.OutputSequenceState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital output lines driven by the PWM hardware. Lines leaving PWM mode are driven low. Starting a pulse train or output sequence on a line takes it out of PWM mode, which is reported in this register, and enabling PWM on a line stops any pulse train or output sequence driving it.
+    /// </summary>
+    [DisplayName("PwmEnablePayload")]
+    [Description("Creates a message payload that specifies the digital output lines driven by the PWM hardware. Lines leaving PWM mode are driven low. Starting a pulse train or output sequence on a line takes it out of PWM mode, which is reported in this register, and enabling PWM on a line stops any pulse train or output sequence driving it.")]
+    public partial class CreatePwmEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital output lines driven by the PWM hardware. Lines leaving PWM mode are driven low. Starting a pulse train or output sequence on a line takes it out of PWM mode, which is reported in this register, and enabling PWM on a line stops any pulse train or output sequence driving it.
+        /// </summary>
+        [Description("The value that specifies the digital output lines driven by the PWM hardware. Lines leaving PWM mode are driven low. Starting a pulse train or output sequence on a line takes it out of PWM mode, which is reported in this register, and enabling PWM on a line stops any pulse train or output sequence driving it.")]
+        public DigitalOutputs PwmEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return PwmEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital output lines driven by the PWM hardware. Lines leaving PWM mode are driven low. Starting a pulse train or output sequence on a line takes it out of PWM mode, which is reported in this register, and enabling PWM on a line stops any pulse train or output sequence driving it.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.PwmEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital output lines driven by the PWM hardware. Lines leaving PWM mode are driven low. Starting a pulse train or output sequence on a line takes it out of PWM mode, which is reported in this register, and enabling PWM on a line stops any pulse train or output sequence driving it.
+    /// </summary>
+    [DisplayName("TimestampedPwmEnablePayload")]
+    [Description("Creates a timestamped message payload that specifies the digital output lines driven by the PWM hardware. Lines leaving PWM mode are driven low. Starting a pulse train or output sequence on a line takes it out of PWM mode, which is reported in this register, and enabling PWM on a line stops any pulse train or output sequence driving it.")]
+    public partial class CreateTimestampedPwmEnablePayload : CreatePwmEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital output lines driven by the PWM hardware. Lines leaving PWM mode are driven low. Starting a pulse train or output sequence on a line takes it out of PWM mode, which is reported in this register, and enabling PWM on a line stops any pulse train or output sequence driving it.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.PwmEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the PWM frequency in Hz of each digital output line, from 8 Hz to half the system clock. Lines GP16-GP17, GP18-GP19 and GP20-GP21 share a PWM slice and must specify the same frequency while both are in PWM mode. The period is resolved to the slice clock, so high frequencies trade duty cycle resolution.
+    /// </summary>
+    [DisplayName("PwmFrequencyPayload")]
+    [Description("Creates a message payload that specifies the PWM frequency in Hz of each digital output line, from 8 Hz to half the system clock. Lines GP16-GP17, GP18-GP19 and GP20-GP21 share a PWM slice and must specify the same frequency while both are in PWM mode. The period is resolved to the slice clock, so high frequencies trade duty cycle resolution.")]
+    public partial class CreatePwmFrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the frequency of digital output line GP15.
+        /// </summary>
+        [Description("The frequency of digital output line GP15.")]
+        public uint GP15 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the frequency of digital output line GP16.
+        /// </summary>
+        [Description("The frequency of digital output line GP16.")]
+        public uint GP16 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the frequency of digital output line GP17.
+        /// </summary>
+        [Description("The frequency of digital output line GP17.")]
+        public uint GP17 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the frequency of digital output line GP18.
+        /// </summary>
+        [Description("The frequency of digital output line GP18.")]
+        public uint GP18 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the frequency of digital output line GP19.
+        /// </summary>
+        [Description("The frequency of digital output line GP19.")]
+        public uint GP19 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the frequency of digital output line GP20.
+        /// </summary>
+        [Description("The frequency of digital output line GP20.")]
+        public uint GP20 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the frequency of digital output line GP21.
+        /// </summary>
+        [Description("The frequency of digital output line GP21.")]
+        public uint GP21 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the frequency of digital output line GP22.
+        /// </summary>
+        [Description("The frequency of digital output line GP22.")]
+        public uint GP22 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmFrequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmFrequencyPayload GetPayload()
+        {
+            PwmFrequencyPayload value;
+            value.GP15 = GP15;
+            value.GP16 = GP16;
+            value.GP17 = GP17;
+            value.GP18 = GP18;
+            value.GP19 = GP19;
+            value.GP20 = GP20;
+            value.GP21 = GP21;
+            value.GP22 = GP22;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the PWM frequency in Hz of each digital output line, from 8 Hz to half the system clock. Lines GP16-GP17, GP18-GP19 and GP20-GP21 share a PWM slice and must specify the same frequency while both are in PWM mode. The period is resolved to the slice clock, so high frequencies trade duty cycle resolution.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmFrequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.PwmFrequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the PWM frequency in Hz of each digital output line, from 8 Hz to half the system clock. Lines GP16-GP17, GP18-GP19 and GP20-GP21 share a PWM slice and must specify the same frequency while both are in PWM mode. The period is resolved to the slice clock, so high frequencies trade duty cycle resolution.
+    /// </summary>
+    [DisplayName("TimestampedPwmFrequencyPayload")]
+    [Description("Creates a timestamped message payload that specifies the PWM frequency in Hz of each digital output line, from 8 Hz to half the system clock. Lines GP16-GP17, GP18-GP19 and GP20-GP21 share a PWM slice and must specify the same frequency while both are in PWM mode. The period is resolved to the slice clock, so high frequencies trade duty cycle resolution.")]
+    public partial class CreateTimestampedPwmFrequencyPayload : CreatePwmFrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the PWM frequency in Hz of each digital output line, from 8 Hz to half the system clock. Lines GP16-GP17, GP18-GP19 and GP20-GP21 share a PWM slice and must specify the same frequency while both are in PWM mode. The period is resolved to the slice clock, so high frequencies trade duty cycle resolution.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmFrequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.PwmFrequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the PWM duty cycle of each digital output line in hundredths of a percent, from 0 to 10000. Updates take effect at the end of the current PWM period, so the output does not glitch.
+    /// </summary>
+    [DisplayName("PwmDutyCyclePayload")]
+    [Description("Creates a message payload that specifies the PWM duty cycle of each digital output line in hundredths of a percent, from 0 to 10000. Updates take effect at the end of the current PWM period, so the output does not glitch.")]
+    public partial class CreatePwmDutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the duty cycle of digital output line GP15.
+        /// </summary>
+        [Description("The duty cycle of digital output line GP15.")]
+        public ushort GP15 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the duty cycle of digital output line GP16.
+        /// </summary>
+        [Description("The duty cycle of digital output line GP16.")]
+        public ushort GP16 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the duty cycle of digital output line GP17.
+        /// </summary>
+        [Description("The duty cycle of digital output line GP17.")]
+        public ushort GP17 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the duty cycle of digital output line GP18.
+        /// </summary>
+        [Description("The duty cycle of digital output line GP18.")]
+        public ushort GP18 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the duty cycle of digital output line GP19.
+        /// </summary>
+        [Description("The duty cycle of digital output line GP19.")]
+        public ushort GP19 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the duty cycle of digital output line GP20.
+        /// </summary>
+        [Description("The duty cycle of digital output line GP20.")]
+        public ushort GP20 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the duty cycle of digital output line GP21.
+        /// </summary>
+        [Description("The duty cycle of digital output line GP21.")]
+        public ushort GP21 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the duty cycle of digital output line GP22.
+        /// </summary>
+        [Description("The duty cycle of digital output line GP22.")]
+        public ushort GP22 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PwmDutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PwmDutyCyclePayload GetPayload()
+        {
+            PwmDutyCyclePayload value;
+            value.GP15 = GP15;
+            value.GP16 = GP16;
+            value.GP17 = GP17;
+            value.GP18 = GP18;
+            value.GP19 = GP19;
+            value.GP20 = GP20;
+            value.GP21 = GP21;
+            value.GP22 = GP22;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the PWM duty cycle of each digital output line in hundredths of a percent, from 0 to 10000. Updates take effect at the end of the current PWM period, so the output does not glitch.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PwmDutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.PwmDutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the PWM duty cycle of each digital output line in hundredths of a percent, from 0 to 10000. Updates take effect at the end of the current PWM period, so the output does not glitch.
+    /// </summary>
+    [DisplayName("TimestampedPwmDutyCyclePayload")]
+    [Description("Creates a timestamped message payload that specifies the PWM duty cycle of each digital output line in hundredths of a percent, from 0 to 10000. Updates take effect at the end of the current PWM period, so the output does not glitch.")]
+    public partial class CreateTimestampedPwmDutyCyclePayload : CreatePwmDutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the PWM duty cycle of each digital output line in hundredths of a percent, from 0 to 10000. Updates take effect at the end of the current PWM period, so the output does not glitch.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PwmDutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.PwmDutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the events reported for pulse trains started from now on. StartStop reports the first pulse of each train and its summary, EveryNth and EveryPulse also report the selected pulses, and None reports neither. Defaults to None, so reporting is opt-in and hosts which do not read these registers receive no additional events. Reported pulses are timestamped at their rising edge, which is computed from the start time and period of the train, so reporting does not load the pulse generation.
+    /// </summary>
+    [DisplayName("PulseTrainReportModePayload")]
+    [Description("Creates a message payload that specifies the events reported for pulse trains started from now on. StartStop reports the first pulse of each train and its summary, EveryNth and EveryPulse also report the selected pulses, and None reports neither. Defaults to None, so reporting is opt-in and hosts which do not read these registers receive no additional events. Reported pulses are timestamped at their rising edge, which is computed from the start time and period of the train, so reporting does not load the pulse generation.")]
+    public partial class CreatePulseTrainReportModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the events reported for pulse trains started from now on. StartStop reports the first pulse of each train and its summary, EveryNth and EveryPulse also report the selected pulses, and None reports neither. Defaults to None, so reporting is opt-in and hosts which do not read these registers receive no additional events. Reported pulses are timestamped at their rising edge, which is computed from the start time and period of the train, so reporting does not load the pulse generation.
+        /// </summary>
+        [Description("The value that specifies the events reported for pulse trains started from now on. StartStop reports the first pulse of each train and its summary, EveryNth and EveryPulse also report the selected pulses, and None reports neither. Defaults to None, so reporting is opt-in and hosts which do not read these registers receive no additional events. Reported pulses are timestamped at their rising edge, which is computed from the start time and period of the train, so reporting does not load the pulse generation.")]
+        public PulseTrainReportMode PulseTrainReportMode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PulseTrainReportMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PulseTrainReportMode GetPayload()
+        {
+            return PulseTrainReportMode;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the events reported for pulse trains started from now on. StartStop reports the first pulse of each train and its summary, EveryNth and EveryPulse also report the selected pulses, and None reports neither. Defaults to None, so reporting is opt-in and hosts which do not read these registers receive no additional events. Reported pulses are timestamped at their rising edge, which is computed from the start time and period of the train, so reporting does not load the pulse generation.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PulseTrainReportMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainReportMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the events reported for pulse trains started from now on. StartStop reports the first pulse of each train and its summary, EveryNth and EveryPulse also report the selected pulses, and None reports neither. Defaults to None, so reporting is opt-in and hosts which do not read these registers receive no additional events. Reported pulses are timestamped at their rising edge, which is computed from the start time and period of the train, so reporting does not load the pulse generation.
+    /// </summary>
+    [DisplayName("TimestampedPulseTrainReportModePayload")]
+    [Description("Creates a timestamped message payload that specifies the events reported for pulse trains started from now on. StartStop reports the first pulse of each train and its summary, EveryNth and EveryPulse also report the selected pulses, and None reports neither. Defaults to None, so reporting is opt-in and hosts which do not read these registers receive no additional events. Reported pulses are timestamped at their rising edge, which is computed from the start time and period of the train, so reporting does not load the pulse generation.")]
+    public partial class CreateTimestampedPulseTrainReportModePayload : CreatePulseTrainReportModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the events reported for pulse trains started from now on. StartStop reports the first pulse of each train and its summary, EveryNth and EveryPulse also report the selected pulses, and None reports neither. Defaults to None, so reporting is opt-in and hosts which do not read these registers receive no additional events. Reported pulses are timestamped at their rising edge, which is computed from the start time and period of the train, so reporting does not load the pulse generation.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PulseTrainReportMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainReportMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the interval, in pulses, between the pulses reported when PulseTrainReportMode is EveryNth. The first pulse of the train is always reported.
+    /// </summary>
+    [DisplayName("PulseTrainReportIntervalPayload")]
+    [Description("Creates a message payload that specifies the interval, in pulses, between the pulses reported when PulseTrainReportMode is EveryNth. The first pulse of the train is always reported.")]
+    public partial class CreatePulseTrainReportIntervalPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the interval, in pulses, between the pulses reported when PulseTrainReportMode is EveryNth. The first pulse of the train is always reported.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that specifies the interval, in pulses, between the pulses reported when PulseTrainReportMode is EveryNth. The first pulse of the train is always reported.")]
+        public ushort PulseTrainReportInterval { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the PulseTrainReportInterval register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return PulseTrainReportInterval;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the interval, in pulses, between the pulses reported when PulseTrainReportMode is EveryNth. The first pulse of the train is always reported.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PulseTrainReportInterval register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainReportInterval.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the interval, in pulses, between the pulses reported when PulseTrainReportMode is EveryNth. The first pulse of the train is always reported.
+    /// </summary>
+    [DisplayName("TimestampedPulseTrainReportIntervalPayload")]
+    [Description("Creates a timestamped message payload that specifies the interval, in pulses, between the pulses reported when PulseTrainReportMode is EveryNth. The first pulse of the train is always reported.")]
+    public partial class CreateTimestampedPulseTrainReportIntervalPayload : CreatePulseTrainReportIntervalPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the interval, in pulses, between the pulses reported when PulseTrainReportMode is EveryNth. The first pulse of the train is always reported.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PulseTrainReportInterval register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainReportInterval.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports a pulse of a pulse train, timestamped at its rising edge. The payload holds the digital output lines of the train and the zero-based index of the pulse.
+    /// </summary>
+    [DisplayName("PulseTrainPulsePayload")]
+    [Description("Creates a message payload that reports a pulse of a pulse train, timestamped at its rising edge. The payload holds the digital output lines of the train and the zero-based index of the pulse.")]
+    public partial class CreatePulseTrainPulsePayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the digital output lines of the pulse train.
+        /// </summary>
+        [Description("The digital output lines of the pulse train.")]
+        public DigitalOutputs DigitalOutput { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the zero-based index of the pulse in the train.
+        /// </summary>
+        [Description("The zero-based index of the pulse in the train.")]
+        public uint PulseIndex { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PulseTrainPulse register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PulseTrainPulsePayload GetPayload()
+        {
+            PulseTrainPulsePayload value;
+            value.DigitalOutput = DigitalOutput;
+            value.PulseIndex = PulseIndex;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that reports a pulse of a pulse train, timestamped at its rising edge. The payload holds the digital output lines of the train and the zero-based index of the pulse.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PulseTrainPulse register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainPulse.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports a pulse of a pulse train, timestamped at its rising edge. The payload holds the digital output lines of the train and the zero-based index of the pulse.
+    /// </summary>
+    [DisplayName("TimestampedPulseTrainPulsePayload")]
+    [Description("Creates a timestamped message payload that reports a pulse of a pulse train, timestamped at its rising edge. The payload holds the digital output lines of the train and the zero-based index of the pulse.")]
+    public partial class CreateTimestampedPulseTrainPulsePayload : CreatePulseTrainPulsePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports a pulse of a pulse train, timestamped at its rising edge. The payload holds the digital output lines of the train and the zero-based index of the pulse.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PulseTrainPulse register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainPulse.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the summary of a reported pulse train once its last line stops, after all its reported pulses. Trains stopped before their first rising edge report zero pulses and zero timestamps. Up to 16 trains can be pending report, and trains started beyond that are not reported and are counted in PulseTrainReportOverrun.
+    /// </summary>
+    [DisplayName("PulseTrainSummaryPayload")]
+    [Description("Creates a message payload that reports the summary of a reported pulse train once its last line stops, after all its reported pulses. Trains stopped before their first rising edge report zero pulses and zero timestamps. Up to 16 trains can be pending report, and trains started beyond that are not reported and are counted in PulseTrainReportOverrun.")]
+    public partial class CreatePulseTrainSummaryPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that the digital output lines of the pulse train.
+        /// </summary>
+        [Description("The digital output lines of the pulse train.")]
+        public ulong DigitalOutput { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the number of pulses generated before the train completed or was stopped, counted from the bursts completed by the pulse generator and the pulses of any burst cut short.
+        /// </summary>
+        [Description("The number of pulses generated before the train completed or was stopped, counted from the bursts completed by the pulse generator and the pulses of any burst cut short.")]
+        public ulong PulseCount { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the Harp time, in microseconds, of the first rising edge of the train.
+        /// </summary>
+        [Description("The Harp time, in microseconds, of the first rising edge of the train.")]
+        public ulong FirstPulseTime { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the Harp time, in microseconds, of the last rising edge of the train.
+        /// </summary>
+        [Description("The Harp time, in microseconds, of the last rising edge of the train.")]
+        public ulong LastPulseTime { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PulseTrainSummary register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PulseTrainSummaryPayload GetPayload()
+        {
+            PulseTrainSummaryPayload value;
+            value.DigitalOutput = DigitalOutput;
+            value.PulseCount = PulseCount;
+            value.FirstPulseTime = FirstPulseTime;
+            value.LastPulseTime = LastPulseTime;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the summary of a reported pulse train once its last line stops, after all its reported pulses. Trains stopped before their first rising edge report zero pulses and zero timestamps. Up to 16 trains can be pending report, and trains started beyond that are not reported and are counted in PulseTrainReportOverrun.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PulseTrainSummary register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainSummary.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the summary of a reported pulse train once its last line stops, after all its reported pulses. Trains stopped before their first rising edge report zero pulses and zero timestamps. Up to 16 trains can be pending report, and trains started beyond that are not reported and are counted in PulseTrainReportOverrun.
+    /// </summary>
+    [DisplayName("TimestampedPulseTrainSummaryPayload")]
+    [Description("Creates a timestamped message payload that reports the summary of a reported pulse train once its last line stops, after all its reported pulses. Trains stopped before their first rising edge report zero pulses and zero timestamps. Up to 16 trains can be pending report, and trains started beyond that are not reported and are counted in PulseTrainReportOverrun.")]
+    public partial class CreateTimestampedPulseTrainSummaryPayload : CreatePulseTrainSummaryPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the summary of a reported pulse train once its last line stops, after all its reported pulses. Trains stopped before their first rising edge report zero pulses and zero timestamps. Up to 16 trains can be pending report, and trains started beyond that are not reported and are counted in PulseTrainReportOverrun.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PulseTrainSummary register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainSummary.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the bursts of finite pulse trains started from now on, including reflex pulse trains. Each burst plays the pulse count of the train, and bursts are timed on-device by the same state machine as the pulses. Pulses are numbered across bursts in pulse reports and pulse-locked sampling. The device loads each burst while the previous one plays, so the burst period must be at least 2000 microseconds. Storing the analog calibration blocks the device for longer than that, and may stretch the gap of bursts playing at the time.
+    /// </summary>
+    [DisplayName("PulseTrainBurstPayload")]
+    [Description("Creates a message payload that specifies the bursts of finite pulse trains started from now on, including reflex pulse trains. Each burst plays the pulse count of the train, and bursts are timed on-device by the same state machine as the pulses. Pulses are numbered across bursts in pulse reports and pulse-locked sampling. The device loads each burst while the previous one plays, so the burst period must be at least 2000 microseconds. Storing the analog calibration blocks the device for longer than that, and may stretch the gap of bursts playing at the time.")]
+    public partial class CreatePulseTrainBurstPayload
+    {
+        /// <summary>
+        /// Gets or sets a value that specifies the number of bursts in the pulse train. A value of one plays a single burst, and a value of zero repeats bursts until the train is stopped.
+        /// </summary>
+        [Description("Specifies the number of bursts in the pulse train. A value of one plays a single burst, and a value of zero repeats bursts until the train is stopped.")]
+        public uint BurstCount { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value that specifies the interval in microseconds from the first rising edge of each burst to the first rising edge of the next burst. Must be longer than the pulse count times the pulse period, and at least 2000 microseconds, when playing more than one burst.
+        /// </summary>
+        [Description("Specifies the interval in microseconds from the first rising edge of each burst to the first rising edge of the next burst. Must be longer than the pulse count times the pulse period, and at least 2000 microseconds, when playing more than one burst.")]
+        public uint BurstPeriod { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the PulseTrainBurst register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public PulseTrainBurstPayload GetPayload()
+        {
+            PulseTrainBurstPayload value;
+            value.BurstCount = BurstCount;
+            value.BurstPeriod = BurstPeriod;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the bursts of finite pulse trains started from now on, including reflex pulse trains. Each burst plays the pulse count of the train, and bursts are timed on-device by the same state machine as the pulses. Pulses are numbered across bursts in pulse reports and pulse-locked sampling. The device loads each burst while the previous one plays, so the burst period must be at least 2000 microseconds. Storing the analog calibration blocks the device for longer than that, and may stretch the gap of bursts playing at the time.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PulseTrainBurst register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainBurst.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the bursts of finite pulse trains started from now on, including reflex pulse trains. Each burst plays the pulse count of the train, and bursts are timed on-device by the same state machine as the pulses. Pulses are numbered across bursts in pulse reports and pulse-locked sampling. The device loads each burst while the previous one plays, so the burst period must be at least 2000 microseconds. Storing the analog calibration blocks the device for longer than that, and may stretch the gap of bursts playing at the time.
+    /// </summary>
+    [DisplayName("TimestampedPulseTrainBurstPayload")]
+    [Description("Creates a timestamped message payload that specifies the bursts of finite pulse trains started from now on, including reflex pulse trains. Each burst plays the pulse count of the train, and bursts are timed on-device by the same state machine as the pulses. Pulses are numbered across bursts in pulse reports and pulse-locked sampling. The device loads each burst while the previous one plays, so the burst period must be at least 2000 microseconds. Storing the analog calibration blocks the device for longer than that, and may stretch the gap of bursts playing at the time.")]
+    public partial class CreateTimestampedPulseTrainBurstPayload : CreatePulseTrainBurstPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the bursts of finite pulse trains started from now on, including reflex pulse trains. Each burst plays the pulse count of the train, and bursts are timed on-device by the same state machine as the pulses. Pulses are numbered across bursts in pulse reports and pulse-locked sampling. The device loads each burst while the previous one plays, so the burst period must be at least 2000 microseconds. Storing the analog calibration blocks the device for longer than that, and may stretch the gap of bursts playing at the time.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PulseTrainBurst register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainBurst.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the number of pulse trains left unreported because every report record was pending, and of output events such as StopPulseTrain and OutputSequenceState dropped because the device could not send them to the host in time.
+    /// </summary>
+    [DisplayName("PulseTrainReportOverrunPayload")]
+    [Description("Creates a message payload that reports the number of pulse trains left unreported because every report record was pending, and of output events such as StopPulseTrain and OutputSequenceState dropped because the device could not send them to the host in time.")]
+    public partial class CreatePulseTrainReportOverrunPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the number of pulse trains left unreported because every report record was pending, and of output events such as StopPulseTrain and OutputSequenceState dropped because the device could not send them to the host in time.
+        /// </summary>
+        [Description("The value that reports the number of pulse trains left unreported because every report record was pending, and of output events such as StopPulseTrain and OutputSequenceState dropped because the device could not send them to the host in time.")]
+        public uint PulseTrainReportOverrun { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the PulseTrainReportOverrun register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return PulseTrainReportOverrun;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the number of pulse trains left unreported because every report record was pending, and of output events such as StopPulseTrain and OutputSequenceState dropped because the device could not send them to the host in time.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the PulseTrainReportOverrun register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainReportOverrun.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the number of pulse trains left unreported because every report record was pending, and of output events such as StopPulseTrain and OutputSequenceState dropped because the device could not send them to the host in time.
+    /// </summary>
+    [DisplayName("TimestampedPulseTrainReportOverrunPayload")]
+    [Description("Creates a timestamped message payload that reports the number of pulse trains left unreported because every report record was pending, and of output events such as StopPulseTrain and OutputSequenceState dropped because the device could not send them to the host in time.")]
+    public partial class CreateTimestampedPulseTrainReportOverrunPayload : CreatePulseTrainReportOverrunPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the number of pulse trains left unreported because every report record was pending, and of output events such as StopPulseTrain and OutputSequenceState dropped because the device could not send them to the host in time.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the PulseTrainReportOverrun register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.PulseTrainReportOverrun.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the number of pulses whose AnalogPulseSample was dropped, either because the device could not send it to the host in time or because the scan was overwritten before it was read.
+    /// </summary>
+    [DisplayName("AnalogPulseSampleOverrunPayload")]
+    [Description("Creates a message payload that reports the number of pulses whose AnalogPulseSample was dropped, either because the device could not send it to the host in time or because the scan was overwritten before it was read.")]
+    public partial class CreateAnalogPulseSampleOverrunPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the number of pulses whose AnalogPulseSample was dropped, either because the device could not send it to the host in time or because the scan was overwritten before it was read.
+        /// </summary>
+        [Description("The value that reports the number of pulses whose AnalogPulseSample was dropped, either because the device could not send it to the host in time or because the scan was overwritten before it was read.")]
+        public uint AnalogPulseSampleOverrun { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the AnalogPulseSampleOverrun register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return AnalogPulseSampleOverrun;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the number of pulses whose AnalogPulseSample was dropped, either because the device could not send it to the host in time or because the scan was overwritten before it was read.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the AnalogPulseSampleOverrun register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogPulseSampleOverrun.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the number of pulses whose AnalogPulseSample was dropped, either because the device could not send it to the host in time or because the scan was overwritten before it was read.
+    /// </summary>
+    [DisplayName("TimestampedAnalogPulseSampleOverrunPayload")]
+    [Description("Creates a timestamped message payload that reports the number of pulses whose AnalogPulseSample was dropped, either because the device could not send it to the host in time or because the scan was overwritten before it was read.")]
+    public partial class CreateTimestampedAnalogPulseSampleOverrunPayload : CreateAnalogPulseSampleOverrunPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the number of pulses whose AnalogPulseSample was dropped, either because the device could not send it to the host in time or because the scan was overwritten before it was read.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the AnalogPulseSampleOverrun register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Hobgoblin.AnalogPulseSampleOverrun.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the StartPulseTrain register.
+    /// </summary>
+    public struct StartPulseTrainPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="StartPulseTrainPayload"/> structure.
+        /// </summary>
+        /// <param name="digitalOutput">Specifies the digital output lines set by each pulse of the pulse train.</param>
+        /// <param name="pulseWidth">Specifies the duration in microseconds that each pulse is HIGH.</param>
+        /// <param name="pulsePeriod">Specifies the interval in microseconds between each pulse in the pulse train.</param>
+        /// <param name="pulseCount">Specifies the number of pulses in the PWM pulse train, or in each burst. A value of zero signifies an infinite pulse train.</param>
+        public StartPulseTrainPayload(
+            DigitalOutputs digitalOutput,
+            uint pulseWidth,
+            uint pulsePeriod,
+            uint pulseCount)
+        {
+            DigitalOutput = digitalOutput;
+            PulseWidth = pulseWidth;
+            PulsePeriod = pulsePeriod;
+            PulseCount = pulseCount;
+        }
+
+        /// <summary>
+        /// Specifies the digital output lines set by each pulse of the pulse train.
+        /// </summary>
+        public DigitalOutputs DigitalOutput;
+
+        /// <summary>
+        /// Specifies the duration in microseconds that each pulse is HIGH.
+        /// </summary>
+        public uint PulseWidth;
+
+        /// <summary>
+        /// Specifies the interval in microseconds between each pulse in the pulse train.
+        /// </summary>
+        public uint PulsePeriod;
+
+        /// <summary>
+        /// Specifies the number of pulses in the PWM pulse train, or in each burst. A value of zero signifies an infinite pulse train.
+        /// </summary>
+        public uint PulseCount;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the StartPulseTrain register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// StartPulseTrain register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "StartPulseTrainPayload { " +
+                "DigitalOutput = " + DigitalOutput + ", " +
+                "PulseWidth = " + PulseWidth + ", " +
+                "PulsePeriod = " + PulsePeriod + ", " +
+                "PulseCount = " + PulseCount + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogData register.
+    /// </summary>
+    public struct AnalogDataPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogDataPayload"/> structure.
+        /// </summary>
+        /// <param name="analogInput0">The analog value sampled from ADC channel 0.</param>
+        /// <param name="analogInput1">The analog value sampled from ADC channel 1.</param>
+        /// <param name="analogInput2">The analog value sampled from ADC channel 2.</param>
+        public AnalogDataPayload(
+            ushort analogInput0,
+            ushort analogInput1,
+            ushort analogInput2)
+        {
+            AnalogInput0 = analogInput0;
+            AnalogInput1 = analogInput1;
+            AnalogInput2 = analogInput2;
+        }
+
+        /// <summary>
+        /// The analog value sampled from ADC channel 0.
+        /// </summary>
+        public ushort AnalogInput0;
+
+        /// <summary>
+        /// The analog value sampled from ADC channel 1.
+        /// </summary>
+        public ushort AnalogInput1;
+
+        /// <summary>
+        /// The analog value sampled from ADC channel 2.
+        /// </summary>
+        public ushort AnalogInput2;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogData register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogData register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogDataPayload { " +
+                "AnalogInput0 = " + AnalogInput0 + ", " +
+                "AnalogInput1 = " + AnalogInput1 + ", " +
+                "AnalogInput2 = " + AnalogInput2 + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogThreshold register.
+    /// </summary>
+    public struct AnalogThresholdPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogThresholdPayload"/> structure.
+        /// </summary>
+        /// <param name="analogInput0">The value for ADC channel 0.</param>
+        /// <param name="analogInput1">The value for ADC channel 1.</param>
+        /// <param name="analogInput2">The value for ADC channel 2.</param>
+        /// <param name="temperature">The value for the internal temperature sensor.</param>
+        public AnalogThresholdPayload(
+            ushort analogInput0,
+            ushort analogInput1,
+            ushort analogInput2,
+            ushort temperature)
+        {
+            AnalogInput0 = analogInput0;
+            AnalogInput1 = analogInput1;
+            AnalogInput2 = analogInput2;
+            Temperature = temperature;
+        }
+
+        /// <summary>
+        /// The value for ADC channel 0.
+        /// </summary>
+        public ushort AnalogInput0;
+
+        /// <summary>
+        /// The value for ADC channel 1.
+        /// </summary>
+        public ushort AnalogInput1;
+
+        /// <summary>
+        /// The value for ADC channel 2.
+        /// </summary>
+        public ushort AnalogInput2;
+
+        /// <summary>
+        /// The value for the internal temperature sensor.
+        /// </summary>
+        public ushort Temperature;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogThreshold register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogThreshold register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogThresholdPayload { " +
+                "AnalogInput0 = " + AnalogInput0 + ", " +
+                "AnalogInput1 = " + AnalogInput1 + ", " +
+                "AnalogInput2 = " + AnalogInput2 + ", " +
+                "Temperature = " + Temperature + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogHysteresis register.
+    /// </summary>
+    public struct AnalogHysteresisPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogHysteresisPayload"/> structure.
+        /// </summary>
+        /// <param name="analogInput0">The value for ADC channel 0.</param>
+        /// <param name="analogInput1">The value for ADC channel 1.</param>
+        /// <param name="analogInput2">The value for ADC channel 2.</param>
+        /// <param name="temperature">The value for the internal temperature sensor.</param>
+        public AnalogHysteresisPayload(
+            ushort analogInput0,
+            ushort analogInput1,
+            ushort analogInput2,
+            ushort temperature)
+        {
+            AnalogInput0 = analogInput0;
+            AnalogInput1 = analogInput1;
+            AnalogInput2 = analogInput2;
+            Temperature = temperature;
+        }
+
+        /// <summary>
+        /// The value for ADC channel 0.
+        /// </summary>
+        public ushort AnalogInput0;
+
+        /// <summary>
+        /// The value for ADC channel 1.
+        /// </summary>
+        public ushort AnalogInput1;
+
+        /// <summary>
+        /// The value for ADC channel 2.
+        /// </summary>
+        public ushort AnalogInput2;
+
+        /// <summary>
+        /// The value for the internal temperature sensor.
+        /// </summary>
+        public ushort Temperature;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogHysteresis register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogHysteresis register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogHysteresisPayload { " +
+                "AnalogInput0 = " + AnalogInput0 + ", " +
+                "AnalogInput1 = " + AnalogInput1 + ", " +
+                "AnalogInput2 = " + AnalogInput2 + ", " +
+                "Temperature = " + Temperature + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogReflexAction register.
+    /// </summary>
+    public struct AnalogReflexActionPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogReflexActionPayload"/> structure.
+        /// </summary>
+        /// <param name="analogInput0">The reflex action for ADC channel 0.</param>
+        /// <param name="analogInput1">The reflex action for ADC channel 1.</param>
+        /// <param name="analogInput2">The reflex action for ADC channel 2.</param>
+        /// <param name="temperature">The reflex action for the internal temperature sensor.</param>
+        public AnalogReflexActionPayload(
+            ReflexAction analogInput0,
+            ReflexAction analogInput1,
+            ReflexAction analogInput2,
+            ReflexAction temperature)
+        {
+            AnalogInput0 = analogInput0;
+            AnalogInput1 = analogInput1;
+            AnalogInput2 = analogInput2;
+            Temperature = temperature;
+        }
+
+        /// <summary>
+        /// The reflex action for ADC channel 0.
+        /// </summary>
+        public ReflexAction AnalogInput0;
+
+        /// <summary>
+        /// The reflex action for ADC channel 1.
+        /// </summary>
+        public ReflexAction AnalogInput1;
+
+        /// <summary>
+        /// The reflex action for ADC channel 2.
+        /// </summary>
+        public ReflexAction AnalogInput2;
+
+        /// <summary>
+        /// The reflex action for the internal temperature sensor.
+        /// </summary>
+        public ReflexAction Temperature;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogReflexAction register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogReflexAction register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogReflexActionPayload { " +
+                "AnalogInput0 = " + AnalogInput0 + ", " +
+                "AnalogInput1 = " + AnalogInput1 + ", " +
+                "AnalogInput2 = " + AnalogInput2 + ", " +
+                "Temperature = " + Temperature + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogReflexOutput register.
+    /// </summary>
+    public struct AnalogReflexOutputPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogReflexOutputPayload"/> structure.
+        /// </summary>
+        /// <param name="analogInput0">The digital output lines driven by ADC channel 0.</param>
+        /// <param name="analogInput1">The digital output lines driven by ADC channel 1.</param>
+        /// <param name="analogInput2">The digital output lines driven by ADC channel 2.</param>
+        /// <param name="temperature">The digital output lines driven by the internal temperature sensor.</param>
+        public AnalogReflexOutputPayload(
+            DigitalOutputs analogInput0,
+            DigitalOutputs analogInput1,
+            DigitalOutputs analogInput2,
+            DigitalOutputs temperature)
+        {
+            AnalogInput0 = analogInput0;
+            AnalogInput1 = analogInput1;
+            AnalogInput2 = analogInput2;
+            Temperature = temperature;
+        }
+
+        /// <summary>
+        /// The digital output lines driven by ADC channel 0.
+        /// </summary>
+        public DigitalOutputs AnalogInput0;
+
+        /// <summary>
+        /// The digital output lines driven by ADC channel 1.
+        /// </summary>
+        public DigitalOutputs AnalogInput1;
+
+        /// <summary>
+        /// The digital output lines driven by ADC channel 2.
+        /// </summary>
+        public DigitalOutputs AnalogInput2;
+
+        /// <summary>
+        /// The digital output lines driven by the internal temperature sensor.
+        /// </summary>
+        public DigitalOutputs Temperature;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogReflexOutput register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogReflexOutput register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogReflexOutputPayload { " +
+                "AnalogInput0 = " + AnalogInput0 + ", " +
+                "AnalogInput1 = " + AnalogInput1 + ", " +
+                "AnalogInput2 = " + AnalogInput2 + ", " +
+                "Temperature = " + Temperature + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogReflexPulseTrain register.
+    /// </summary>
+    public struct AnalogReflexPulseTrainPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogReflexPulseTrainPayload"/> structure.
+        /// </summary>
+        /// <param name="pulseWidth">Specifies the duration in microseconds that each pulse is HIGH.</param>
+        /// <param name="pulsePeriod">Specifies the interval in microseconds between each pulse in the pulse train.</param>
+        /// <param name="pulseCount">Specifies the number of pulses in the pulse train. A value of zero signifies an infinite pulse train.</param>
+        public AnalogReflexPulseTrainPayload(
+            uint pulseWidth,
+            uint pulsePeriod,
+            uint pulseCount)
+        {
+            PulseWidth = pulseWidth;
+            PulsePeriod = pulsePeriod;
+            PulseCount = pulseCount;
+        }
+
+        /// <summary>
+        /// Specifies the duration in microseconds that each pulse is HIGH.
+        /// </summary>
+        public uint PulseWidth;
+
+        /// <summary>
+        /// Specifies the interval in microseconds between each pulse in the pulse train.
+        /// </summary>
+        public uint PulsePeriod;
+
+        /// <summary>
+        /// Specifies the number of pulses in the pulse train. A value of zero signifies an infinite pulse train.
+        /// </summary>
+        public uint PulseCount;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogReflexPulseTrain register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogReflexPulseTrain register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogReflexPulseTrainPayload { " +
+                "PulseWidth = " + PulseWidth + ", " +
+                "PulsePeriod = " + PulsePeriod + ", " +
+                "PulseCount = " + PulseCount + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogCaptureWindow register.
+    /// </summary>
+    public struct AnalogCaptureWindowPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogCaptureWindowPayload"/> structure.
+        /// </summary>
+        /// <param name="preTrigger">Specifies the number of scans recorded before the trigger.</param>
+        /// <param name="postTrigger">Specifies the number of scans recorded after the trigger, including the scan containing the trigger.</param>
+        public AnalogCaptureWindowPayload(
+            ushort preTrigger,
+            ushort postTrigger)
+        {
+            PreTrigger = preTrigger;
+            PostTrigger = postTrigger;
+        }
+
+        /// <summary>
+        /// Specifies the number of scans recorded before the trigger.
+        /// </summary>
+        public ushort PreTrigger;
+
+        /// <summary>
+        /// Specifies the number of scans recorded after the trigger, including the scan containing the trigger.
+        /// </summary>
+        public ushort PostTrigger;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogCaptureWindow register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogCaptureWindow register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogCaptureWindowPayload { " +
+                "PreTrigger = " + PreTrigger + ", " +
+                "PostTrigger = " + PostTrigger + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogCalibrationOffset register.
+    /// </summary>
+    public struct AnalogCalibrationOffsetPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogCalibrationOffsetPayload"/> structure.
+        /// </summary>
+        /// <param name="analogInput0">The value for ADC channel 0.</param>
+        /// <param name="analogInput1">The value for ADC channel 1.</param>
+        /// <param name="analogInput2">The value for ADC channel 2.</param>
+        /// <param name="temperature">The value for the internal temperature sensor.</param>
+        public AnalogCalibrationOffsetPayload(
+            short analogInput0,
+            short analogInput1,
+            short analogInput2,
+            short temperature)
+        {
+            AnalogInput0 = analogInput0;
+            AnalogInput1 = analogInput1;
+            AnalogInput2 = analogInput2;
+            Temperature = temperature;
+        }
+
+        /// <summary>
+        /// The value for ADC channel 0.
+        /// </summary>
+        public short AnalogInput0;
+
+        /// <summary>
+        /// The value for ADC channel 1.
+        /// </summary>
+        public short AnalogInput1;
+
+        /// <summary>
+        /// The value for ADC channel 2.
+        /// </summary>
+        public short AnalogInput2;
+
+        /// <summary>
+        /// The value for the internal temperature sensor.
+        /// </summary>
+        public short Temperature;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogCalibrationOffset register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogCalibrationOffset register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogCalibrationOffsetPayload { " +
+                "AnalogInput0 = " + AnalogInput0 + ", " +
+                "AnalogInput1 = " + AnalogInput1 + ", " +
+                "AnalogInput2 = " + AnalogInput2 + ", " +
+                "Temperature = " + Temperature + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogCalibrationGain register.
+    /// </summary>
+    public struct AnalogCalibrationGainPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogCalibrationGainPayload"/> structure.
+        /// </summary>
+        /// <param name="analogInput0">The value for ADC channel 0.</param>
+        /// <param name="analogInput1">The value for ADC channel 1.</param>
+        /// <param name="analogInput2">The value for ADC channel 2.</param>
+        /// <param name="temperature">The value for the internal temperature sensor.</param>
+        public AnalogCalibrationGainPayload(
+            ushort analogInput0,
+            ushort analogInput1,
+            ushort analogInput2,
+            ushort temperature)
+        {
+            AnalogInput0 = analogInput0;
+            AnalogInput1 = analogInput1;
+            AnalogInput2 = analogInput2;
+            Temperature = temperature;
+        }
+
+        /// <summary>
+        /// The value for ADC channel 0.
+        /// </summary>
+        public ushort AnalogInput0;
+
+        /// <summary>
+        /// The value for ADC channel 1.
+        /// </summary>
+        public ushort AnalogInput1;
+
+        /// <summary>
+        /// The value for ADC channel 2.
+        /// </summary>
+        public ushort AnalogInput2;
+
+        /// <summary>
+        /// The value for the internal temperature sensor.
+        /// </summary>
+        public ushort Temperature;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogCalibrationGain register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogCalibrationGain register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogCalibrationGainPayload { " +
+                "AnalogInput0 = " + AnalogInput0 + ", " +
+                "AnalogInput1 = " + AnalogInput1 + ", " +
+                "AnalogInput2 = " + AnalogInput2 + ", " +
+                "Temperature = " + Temperature + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogBiquadSections register.
+    /// </summary>
+    public struct AnalogBiquadSectionsPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogBiquadSectionsPayload"/> structure.
+        /// </summary>
+        /// <param name="analogInput0">The value for ADC channel 0.</param>
+        /// <param name="analogInput1">The value for ADC channel 1.</param>
+        /// <param name="analogInput2">The value for ADC channel 2.</param>
+        /// <param name="temperature">The value for the internal temperature sensor.</param>
+        public AnalogBiquadSectionsPayload(
+            byte analogInput0,
+            byte analogInput1,
+            byte analogInput2,
+            byte temperature)
+        {
+            AnalogInput0 = analogInput0;
+            AnalogInput1 = analogInput1;
+            AnalogInput2 = analogInput2;
+            Temperature = temperature;
+        }
+
+        /// <summary>
+        /// The value for ADC channel 0.
+        /// </summary>
+        public byte AnalogInput0;
+
+        /// <summary>
+        /// The value for ADC channel 1.
+        /// </summary>
+        public byte AnalogInput1;
+
+        /// <summary>
+        /// The value for ADC channel 2.
+        /// </summary>
+        public byte AnalogInput2;
+
+        /// <summary>
+        /// The value for the internal temperature sensor.
+        /// </summary>
+        public byte Temperature;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogBiquadSections register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogBiquadSections register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogBiquadSectionsPayload { " +
+                "AnalogInput0 = " + AnalogInput0 + ", " +
+                "AnalogInput1 = " + AnalogInput1 + ", " +
+                "AnalogInput2 = " + AnalogInput2 + ", " +
+                "Temperature = " + Temperature + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the AnalogEnvelopeMode register.
+    /// </summary>
+    public struct AnalogEnvelopeModePayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="AnalogEnvelopeModePayload"/> structure.
+        /// </summary>
+        /// <param name="analogInput0">The envelope mode for ADC channel 0.</param>
+        /// <param name="analogInput1">The envelope mode for ADC channel 1.</param>
+        /// <param name="analogInput2">The envelope mode for ADC channel 2.</param>
+        /// <param name="temperature">The envelope mode for the internal temperature sensor.</param>
+        public AnalogEnvelopeModePayload(
+            EnvelopeMode analogInput0,
+            EnvelopeMode analogInput1,
+            EnvelopeMode analogInput2,
+            EnvelopeMode temperature)
+        {
+            AnalogInput0 = analogInput0;
+            AnalogInput1 = analogInput1;
+            AnalogInput2 = analogInput2;
+            Temperature = temperature;
+        }
+
+        /// <summary>
+        /// The envelope mode for ADC channel 0.
+        /// </summary>
+        public EnvelopeMode AnalogInput0;
+
+        /// <summary>
+        /// The envelope mode for ADC channel 1.
+        /// </summary>
+        public EnvelopeMode AnalogInput1;
+
+        /// <summary>
+        /// The envelope mode for ADC channel 2.
+        /// </summary>
+        public EnvelopeMode AnalogInput2;
+
+        /// <summary>
+        /// The envelope mode for the internal temperature sensor.
+        /// </summary>
+        public EnvelopeMode Temperature;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the AnalogEnvelopeMode register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// AnalogEnvelopeMode register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "AnalogEnvelopeModePayload { " +
+                "AnalogInput0 = " + AnalogInput0 + ", " +
+                "AnalogInput1 = " + AnalogInput1 + ", " +
+                "AnalogInput2 = " + AnalogInput2 + ", " +
+                "Temperature = " + Temperature + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the StartOutputSequence register.
+    /// </summary>
+    public struct StartOutputSequencePayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="StartOutputSequencePayload"/> structure.
+        /// </summary>
+        /// <param name="digitalOutput">Specifies the digital output lines driven by the sequence.</param>
+        /// <param name="loopCount">Specifies the number of times the sequence is played. A value of zero plays the sequence until it is stopped.</param>
+        public StartOutputSequencePayload(
+            DigitalOutputs digitalOutput,
+            byte loopCount)
+        {
+            DigitalOutput = digitalOutput;
+            LoopCount = loopCount;
+        }
+
+        /// <summary>
+        /// Specifies the digital output lines driven by the sequence.
+        /// </summary>
+        public DigitalOutputs DigitalOutput;
+
+        /// <summary>
+        /// Specifies the number of times the sequence is played. A value of zero plays the sequence until it is stopped.
+        /// </summary>
+        public byte LoopCount;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the StartOutputSequence register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// StartOutputSequence register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Hobgoblin.DigitalOutputState.FromPayload(timestamp, messageType, GetPayload());
+            return "StartOutputSequencePayload { " +
+                "DigitalOutput = " + DigitalOutput + ", " +
+                "LoopCount = " + LoopCount + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that starts a pulse train driving the specified digital output lines.
+    /// Represents the payload of the PwmFrequency register.
     /// </summary>
-    [DisplayName("StartPulseTrainPayload")]
-    [Description("Creates a message payload that starts a pulse train driving the specified digital output lines.")]
-    public partial class CreateStartPulseTrainPayload
+    public struct PwmFrequencyPayload
     {
         /// <summary>
-        /// Gets or sets a value that specifies the digital output lines set by each pulse of the pulse train.
+        /// Initializes a new instance of the <see cref="PwmFrequencyPayload"/> structure.
+        /// </summary>
+        /// <param name="gP15">The frequency of digital output line GP15.</param>
+        /// <param name="gP16">The frequency of digital output line GP16.</param>
+        /// <param name="gP17">The frequency of digital output line GP17.</param>
+        /// <param name="gP18">The frequency of digital output line GP18.</param>
+        /// <param name="gP19">The frequency of digital output line GP19.</param>
+        /// <param name="gP20">The frequency of digital output line GP20.</param>
+        /// <param name="gP21">The frequency of digital output line GP21.</param>
+        /// <param name="gP22">The frequency of digital output line GP22.</param>
+        public PwmFrequencyPayload(
+            uint gP15,
+            uint gP16,
+            uint gP17,
+            uint gP18,
+            uint gP19,
+            uint gP20,
+            uint gP21,
+            uint gP22)
+        {
+            GP15 = gP15;
+            GP16 = gP16;
+            GP17 = gP17;
+            GP18 = gP18;
+            GP19 = gP19;
+            GP20 = gP20;
+            GP21 = gP21;
+            GP22 = gP22;
+        }
+
+        /// <summary>
+        /// The frequency of digital output line GP15.
         /// </summary>
-        [Description("Specifies the digital output lines set by each pulse of the pulse train.")]
-        public DigitalOutputs DigitalOutput { get; set; }
+        public uint GP15;
 
         /// <summary>
-        /// Gets or sets a value that specifies the duration in microseconds that each pulse is HIGH.
+        /// The frequency of digital output line GP16.
         /// </summary>
-        [Description("Specifies the duration in microseconds that each pulse is HIGH.")]
-        public uint PulseWidth { get; set; } = 500000;
+        public uint GP16;
 
         /// <summary>
-        /// Gets or sets a value that specifies the interval in microseconds between each pulse in the pulse train.
+        /// The frequency of digital output line GP17.
         /// </summary>
-        [Description("Specifies the interval in microseconds between each pulse in the pulse train.")]
-        public uint PulsePeriod { get; set; } = 1000000;
+        public uint GP17;
 
         /// <summary>
-        /// Gets or sets a value that specifies the number of pulses in the PWM pulse train. A value of zero signifies an infinite pulse train.
+        /// The frequency of digital output line GP18.
         /// </summary>
-        [Description("Specifies the number of pulses in the PWM pulse train. A value of zero signifies an infinite pulse train.")]
-        public uint PulseCount { get; set; } = 1;
+        public uint GP18;
 
         /// <summary>
-        /// Creates a message payload for the StartPulseTrain register.
+        /// The frequency of digital output line GP19.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public StartPulseTrainPayload GetPayload()
-        {
-            StartPulseTrainPayload value;
-            value.DigitalOutput = DigitalOutput;
-            value.PulseWidth = PulseWidth;
-            value.PulsePeriod = PulsePeriod;
-            value.PulseCount = PulseCount;
-            return value;
-        }
+        public uint GP19;
 
         /// <summary>
-        /// Creates a message that starts a pulse train driving the specified digital output lines.
+        /// The frequency of digital output line GP20.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the StartPulseTrain register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public uint GP20;
+
+        /// <summary>
+        /// The frequency of digital output line GP21.
+        /// </summary>
+        public uint GP21;
+
+        /// <summary>
+        /// The frequency of digital output line GP22.
+        /// </summary>
+        public uint GP22;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PwmFrequency register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PwmFrequency register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Hobgoblin.StartPulseTrain.FromPayload(messageType, GetPayload());
+            return "PwmFrequencyPayload { " +
+                "GP15 = " + GP15 + ", " +
+                "GP16 = " + GP16 + ", " +
+                "GP17 = " + GP17 + ", " +
+                "GP18 = " + GP18 + ", " +
+                "GP19 = " + GP19 + ", " +
+                "GP20 = " + GP20 + ", " +
+                "GP21 = " + GP21 + ", " +
+                "GP22 = " + GP22 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that starts a pulse train driving the specified digital output lines.
+    /// Represents the payload of the PwmDutyCycle register.
     /// </summary>
-    [DisplayName("TimestampedStartPulseTrainPayload")]
-    [Description("Creates a timestamped message payload that starts a pulse train driving the specified digital output lines.")]
-    public partial class CreateTimestampedStartPulseTrainPayload : CreateStartPulseTrainPayload
+    public struct PwmDutyCyclePayload
     {
         /// <summary>
-        /// Creates a timestamped message that starts a pulse train driving the specified digital output lines.
-        /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the StartPulseTrain register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// Initializes a new instance of the <see cref="PwmDutyCyclePayload"/> structure.
+        /// </summary>
+        /// <param name="gP15">The duty cycle of digital output line GP15.</param>
+        /// <param name="gP16">The duty cycle of digital output line GP16.</param>
+        /// <param name="gP17">The duty cycle of digital output line GP17.</param>
+        /// <param name="gP18">The duty cycle of digital output line GP18.</param>
+        /// <param name="gP19">The duty cycle of digital output line GP19.</param>
+        /// <param name="gP20">The duty cycle of digital output line GP20.</param>
+        /// <param name="gP21">The duty cycle of digital output line GP21.</param>
+        /// <param name="gP22">The duty cycle of digital output line GP22.</param>
+        public PwmDutyCyclePayload(
+            ushort gP15,
+            ushort gP16,
+            ushort gP17,
+            ushort gP18,
+            ushort gP19,
+            ushort gP20,
+            ushort gP21,
+            ushort gP22)
         {
-            return Harp.Hobgoblin.StartPulseTrain.FromPayload(timestamp, messageType, GetPayload());
+            GP15 = gP15;
+            GP16 = gP16;
+            GP17 = gP17;
+            GP18 = gP18;
+            GP19 = gP19;
+            GP20 = gP20;
+            GP21 = gP21;
+            GP22 = gP22;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that stops the pulse train running on the specified digital output lines.
-    /// </summary>
-    [DisplayName("StopPulseTrainPayload")]
-    [Description("Creates a message payload that stops the pulse train running on the specified digital output lines.")]
-    public partial class CreateStopPulseTrainPayload
-    {
         /// <summary>
-        /// Gets or sets the value that stops the pulse train running on the specified digital output lines.
+        /// The duty cycle of digital output line GP15.
         /// </summary>
-        [Description("The value that stops the pulse train running on the specified digital output lines.")]
-        public DigitalOutputs StopPulseTrain { get; set; }
+        public ushort GP15;
 
         /// <summary>
-        /// Creates a message payload for the StopPulseTrain register.
+        /// The duty cycle of digital output line GP16.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
-        {
-            return StopPulseTrain;
-        }
+        public ushort GP16;
 
         /// <summary>
-        /// Creates a message that stops the pulse train running on the specified digital output lines.
+        /// The duty cycle of digital output line GP17.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the StopPulseTrain register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
-        {
-            return Harp.Hobgoblin.StopPulseTrain.FromPayload(messageType, GetPayload());
-        }
-    }
+        public ushort GP17;
 
-    /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that stops the pulse train running on the specified digital output lines.
-    /// </summary>
-    [DisplayName("TimestampedStopPulseTrainPayload")]
-    [Description("Creates a timestamped message payload that stops the pulse train running on the specified digital output lines.")]
-    public partial class CreateTimestampedStopPulseTrainPayload : CreateStopPulseTrainPayload
-    {
         /// <summary>
-        /// Creates a timestamped message that stops the pulse train running on the specified digital output lines.
+        /// The duty cycle of digital output line GP18.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the StopPulseTrain register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
-        {
-            return Harp.Hobgoblin.StopPulseTrain.FromPayload(timestamp, messageType, GetPayload());
-        }
-    }
+        public ushort GP18;
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution.
-    /// </summary>
-    [DisplayName("AnalogDataPayload")]
-    [Description("Creates a message payload that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution.")]
-    public partial class CreateAnalogDataPayload
-    {
         /// <summary>
-        /// Gets or sets a value that the analog value sampled from ADC channel 0.
+        /// The duty cycle of digital output line GP19.
         /// </summary>
-        [Description("The analog value sampled from ADC channel 0.")]
-        public ushort AnalogInput0 { get; set; }
+        public ushort GP19;
 
         /// <summary>
-        /// Gets or sets a value that the analog value sampled from ADC channel 1.
+        /// The duty cycle of digital output line GP20.
         /// </summary>
-        [Description("The analog value sampled from ADC channel 1.")]
-        public ushort AnalogInput1 { get; set; }
+        public ushort GP20;
 
         /// <summary>
-        /// Gets or sets a value that the analog value sampled from ADC channel 2.
+        /// The duty cycle of digital output line GP21.
         /// </summary>
-        [Description("The analog value sampled from ADC channel 2.")]
-        public ushort AnalogInput2 { get; set; }
+        public ushort GP21;
 
         /// <summary>
-        /// Creates a message payload for the AnalogData register.
+        /// The duty cycle of digital output line GP22.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public AnalogDataPayload GetPayload()
-        {
-            AnalogDataPayload value;
-            value.AnalogInput0 = AnalogInput0;
-            value.AnalogInput1 = AnalogInput1;
-            value.AnalogInput2 = AnalogInput2;
-            return value;
-        }
+        public ushort GP22;
 
         /// <summary>
-        /// Creates a message that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution.
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PwmDutyCycle register.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the AnalogData register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PwmDutyCycle register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Hobgoblin.AnalogData.FromPayload(messageType, GetPayload());
+            return "PwmDutyCyclePayload { " +
+                "GP15 = " + GP15 + ", " +
+                "GP16 = " + GP16 + ", " +
+                "GP17 = " + GP17 + ", " +
+                "GP18 = " + GP18 + ", " +
+                "GP19 = " + GP19 + ", " +
+                "GP20 = " + GP20 + ", " +
+                "GP21 = " + GP21 + ", " +
+                "GP22 = " + GP22 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution.
+    /// Represents the payload of the PulseTrainPulse register.
     /// </summary>
-    [DisplayName("TimestampedAnalogDataPayload")]
-    [Description("Creates a timestamped message payload that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution.")]
-    public partial class CreateTimestampedAnalogDataPayload : CreateAnalogDataPayload
+    public struct PulseTrainPulsePayload
     {
         /// <summary>
-        /// Creates a timestamped message that reports the sampled analog signal on each of the ADC input channels. The ADC is capped at 12 bits of resolution.
+        /// Initializes a new instance of the <see cref="PulseTrainPulsePayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the AnalogData register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="digitalOutput">The digital output lines of the pulse train.</param>
+        /// <param name="pulseIndex">The zero-based index of the pulse in the train.</param>
+        public PulseTrainPulsePayload(
+            DigitalOutputs digitalOutput,
+            uint pulseIndex)
         {
-            return Harp.Hobgoblin.AnalogData.FromPayload(timestamp, messageType, GetPayload());
+            DigitalOutput = digitalOutput;
+            PulseIndex = pulseIndex;
+        }
+
+        /// <summary>
+        /// The digital output lines of the pulse train.
+        /// </summary>
+        public DigitalOutputs DigitalOutput;
+
+        /// <summary>
+        /// The zero-based index of the pulse in the train.
+        /// </summary>
+        public uint PulseIndex;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the PulseTrainPulse register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// PulseTrainPulse register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "PulseTrainPulsePayload { " +
+                "DigitalOutput = " + DigitalOutput + ", " +
+                "PulseIndex = " + PulseIndex + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents the payload of the StartPulseTrain register.
+    /// Represents the payload of the PulseTrainSummary register.
     /// </summary>
-    public struct StartPulseTrainPayload
+    public struct PulseTrainSummaryPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="StartPulseTrainPayload"/> structure.
-        /// </summary>
-        /// <param name="digitalOutput">Specifies the digital output lines set by each pulse of the pulse train.</param>
-        /// <param name="pulseWidth">Specifies the duration in microseconds that each pulse is HIGH.</param>
-        /// <param name="pulsePeriod">Specifies the interval in microseconds between each pulse in the pulse train.</param>
-        /// <param name="pulseCount">Specifies the number of pulses in the PWM pulse train. A value of zero signifies an infinite pulse train.</param>
-        public StartPulseTrainPayload(
-            DigitalOutputs digitalOutput,
-            uint pulseWidth,
-            uint pulsePeriod,
-            uint pulseCount)
+        /// Initializes a new instance of the <see cref="PulseTrainSummaryPayload"/> structure.
+        /// </summary>
+        /// <param name="digitalOutput">The digital output lines of the pulse train.</param>
+        /// <param name="pulseCount">The number of pulses generated before the train completed or was stopped, counted from the bursts completed by the pulse generator and the pulses of any burst cut short.</param>
+        /// <param name="firstPulseTime">The Harp time, in microseconds, of the first rising edge of the train.</param>
+        /// <param name="lastPulseTime">The Harp time, in microseconds, of the last rising edge of the train.</param>
+        public PulseTrainSummaryPayload(
+            ulong digitalOutput,
+            ulong pulseCount,
+            ulong firstPulseTime,
+            ulong lastPulseTime)
         {
             DigitalOutput = digitalOutput;
-            PulseWidth = pulseWidth;
-            PulsePeriod = pulsePeriod;
             PulseCount = pulseCount;
+            FirstPulseTime = firstPulseTime;
+            LastPulseTime = lastPulseTime;
         }
 
         /// <summary>
-        /// Specifies the digital output lines set by each pulse of the pulse train.
+        /// The digital output lines of the pulse train.
         /// </summary>
-        public DigitalOutputs DigitalOutput;
+        public ulong DigitalOutput;
 
         /// <summary>
-        /// Specifies the duration in microseconds that each pulse is HIGH.
+        /// The number of pulses generated before the train completed or was stopped, counted from the bursts completed by the pulse generator and the pulses of any burst cut short.
         /// </summary>
-        public uint PulseWidth;
+        public ulong PulseCount;
 
         /// <summary>
-        /// Specifies the interval in microseconds between each pulse in the pulse train.
+        /// The Harp time, in microseconds, of the first rising edge of the train.
         /// </summary>
-        public uint PulsePeriod;
+        public ulong FirstPulseTime;
 
         /// <summary>
-        /// Specifies the number of pulses in the PWM pulse train. A value of zero signifies an infinite pulse train.
+        /// The Harp time, in microseconds, of the last rising edge of the train.
         /// </summary>
-        public uint PulseCount;
+        public ulong LastPulseTime;
 
         /// <summary>
         /// Returns a <see cref="string"/> that represents the payload of
-        /// the StartPulseTrain register.
+        /// the PulseTrainSummary register.
         /// </summary>
         /// <returns>
         /// A <see cref="string"/> that represents the payload of the
-        /// StartPulseTrain register.
+        /// PulseTrainSummary register.
         /// </returns>
         public override string ToString()
         {
-            return "StartPulseTrainPayload { " +
+            return "PulseTrainSummaryPayload { " +
                 "DigitalOutput = " + DigitalOutput + ", " +
-                "PulseWidth = " + PulseWidth + ", " +
-                "PulsePeriod = " + PulsePeriod + ", " +
-                "PulseCount = " + PulseCount + " " +
+                "PulseCount = " + PulseCount + ", " +
+                "FirstPulseTime = " + FirstPulseTime + ", " +
+                "LastPulseTime = " + LastPulseTime + " " +
             "}";
         }
     }
 
     /// <summary>
-    /// Represents the payload of the AnalogData register.
+    /// Represents the payload of the PulseTrainBurst register.
     /// </summary>
-    public struct AnalogDataPayload
+    public struct PulseTrainBurstPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="AnalogDataPayload"/> structure.
+        /// Initializes a new instance of the <see cref="PulseTrainBurstPayload"/> structure.
         /// </summary>
-        /// <param name="analogInput0">The analog value sampled from ADC channel 0.</param>
-        /// <param name="analogInput1">The analog value sampled from ADC channel 1.</param>
-        /// <param name="analogInput2">The analog value sampled from ADC channel 2.</param>
-        public AnalogDataPayload(
-            ushort analogInput0,
-            ushort analogInput1,
-            ushort analogInput2)
+        /// <param name="burstCount">Specifies the number of bursts in the pulse train. A value of one plays a single burst, and a value of zero repeats bursts until the train is stopped.</param>
+        /// <param name="burstPeriod">Specifies the interval in microseconds from the first rising edge of each burst to the first rising edge of the next burst. Must be longer than the pulse count times the pulse period, and at least 2000 microseconds, when playing more than one burst.</param>
+        public PulseTrainBurstPayload(
+            uint burstCount,
+            uint burstPeriod)
         {
-            AnalogInput0 = analogInput0;
-            AnalogInput1 = analogInput1;
-            AnalogInput2 = analogInput2;
+            BurstCount = burstCount;
+            BurstPeriod = burstPeriod;
         }
 
         /// <summary>
-        /// The analog value sampled from ADC channel 0.
-        /// </summary>
-        public ushort AnalogInput0;
-
-        /// <summary>
-        /// The analog value sampled from ADC channel 1.
+        /// Specifies the number of bursts in the pulse train. A value of one plays a single burst, and a value of zero repeats bursts until the train is stopped.
         /// </summary>
-        public ushort AnalogInput1;
+        public uint BurstCount;
 
         /// <summary>
-        /// The analog value sampled from ADC channel 2.
+        /// Specifies the interval in microseconds from the first rising edge of each burst to the first rising edge of the next burst. Must be longer than the pulse count times the pulse period, and at least 2000 microseconds, when playing more than one burst.
         /// </summary>
-        public ushort AnalogInput2;
+        public uint BurstPeriod;
 
         /// <summary>
         /// Returns a <see cref="string"/> that represents the payload of
-        /// the AnalogData register.
+        /// the PulseTrainBurst register.
         /// </summary>
         /// <returns>
         /// A <see cref="string"/> that represents the payload of the
-        /// AnalogData register.
+        /// PulseTrainBurst register.
         /// </returns>
         public override string ToString()
         {
-            return "AnalogDataPayload { " +
-                "AnalogInput0 = " + AnalogInput0 + ", " +
-                "AnalogInput1 = " + AnalogInput1 + ", " +
-                "AnalogInput2 = " + AnalogInput2 + " " +
+            return "PulseTrainBurstPayload { " +
+                "BurstCount = " + BurstCount + ", " +
+                "BurstPeriod = " + BurstPeriod + " " +
             "}";
         }
     }
@@ -1827,6 +11779,19 @@ namespace Harp.Hobgoblin
         GP14 = 0x10
     }
 
+    /// <summary>
+    /// Specifies the analog input channels of the ADC.
+    /// </summary>
+    [Flags]
+    public enum AnalogChannels : byte
+    {
+        None = 0x0,
+        AnalogInput0 = 0x1,
+        AnalogInput1 = 0x2,
+        AnalogInput2 = 0x4,
+        Temperature = 0x10
+    }
+
     /// <summary>
     /// Specifies the state of port digital output lines.
     /// </summary>
@@ -1843,4 +11808,78 @@ namespace Harp.Hobgoblin
         GP21 = 0x40,
         GP22 = 0x80
     }
+
+    /// <summary>
+    /// Specifies whether a specific feature is enabled.
+    /// </summary>
+    public enum EnableFlag : byte
+    {
+        Disabled = 0,
+        Enabled = 1
+    }
+
+    /// <summary>
+    /// Specifies the action applied to digital outputs when an analog channel crosses its threshold.
+    /// </summary>
+    public enum ReflexAction : byte
+    {
+        None = 0,
+        Set = 1,
+        Clear = 2,
+        Toggle = 3,
+        Follow = 4,
+        PulseTrain = 5
+    }
+
+    /// <summary>
+    /// Specifies the events reported for a pulse train.
+    /// </summary>
+    public enum PulseTrainReportMode : byte
+    {
+        None = 0,
+        StartStop = 1,
+        EveryNth = 2,
+        EveryPulse = 3
+    }
+
+    /// <summary>
+    /// Specifies the amplitude envelope reported for an analog channel.
+    /// </summary>
+    public enum EnvelopeMode : byte
+    {
+        None = 0,
+        Rectified = 1,
+        Rms = 2
+    }
+
+    /// <summary>
+    /// Specifies the source which triggers an analog capture.
+    /// </summary>
+    public enum CaptureTrigger : byte
+    {
+        None = 0,
+        DigitalInput = 1,
+        AnalogThreshold = 2
+    }
+
+    /// <summary>
+    /// Specifies an operation on the persisted analog calibration.
+    /// </summary>
+    public enum CalibrationCommand : byte
+    {
+        None = 0,
+        Store = 1,
+        Load = 2,
+        Clear = 3
+    }
+
+    /// <summary>
+    /// Specifies the format used to report analog frames.
+    /// </summary>
+    public enum AnalogDataFormat : byte
+    {
+        Unpacked = 0,
+        Packed = 1,
+        Compressed = 2
+    }
 }